@@ -8,6 +8,8 @@ CONTAINERS=(queue stack sorted_list bst counter staticarray)
 declare -A SOURCES
 SOURCES=([queue]=queue [stack]=stack [sorted_list]=sorted_list [bst]=bst [counter]=counter [staticarray]=staticarray)
 EXTRA_HEADERS=(extensions)
+declare -A DEPENDENCIES
+DEPENDENCIES=([queue]="pool shm_queue concurrent_queue" [stack]="pool concurrent_stack" [counter]="flat_map dense_map space_saving count_min_sketch concurrent_counter window_counter token_counter" [staticarray]="static_hash_map static_vector")
 
 check_return_code() {
     until eval $1;
@@ -80,6 +82,9 @@ build_library() {
         for extra in ${EXTRA_HEADERS[@]}; do
             check_return_code "cp ../src/$extra.h $PLACE_HEADERS/$COMMONDIR/$lib/"
         done
+        for dependency in ${DEPENDENCIES[$lib]}; do
+            check_return_code "cp ../src/$dependency.h $PLACE_HEADERS/$COMMONDIR/$lib/"
+        done
     done
     check_return_code "cd ../"
     check_return_code "rm -rf build_lib"
@@ -169,3 +174,4 @@ unset SOURCES
 unset COMMONDIR
 unset CONTAINERS
 unset EXTRA_HEADERS
+unset DEPENDENCIES
@@ -1,5 +1,224 @@
 /*
  * This file required to create the `.so` library.
+ * Also, it contains the C interface of the `bst` class.
  */
 #include "bst.h"
+#include "type_erased.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
 
+namespace pure_c
+{
+using _helpers_type_erased::element;
+using _helpers_type_erased::element_iterator;
+using _helpers_type_erased::element_type;
+
+/*
+ * The interface of the trees, which store the elements of the different capacities.
+ */
+struct c_bst_core
+{
+    virtual ~c_bst_core() = default;
+    virtual int insert(const void* value) = 0;
+    virtual size_t insert_n(const void* values, size_t n) = 0;
+    virtual int find(const void* value) const = 0;
+    virtual int remove(const void* value) = 0;
+    virtual int min(void* buffer) const = 0;
+    virtual int max(void* buffer) const = 0;
+    virtual size_t to_array(void* buffer, size_t n) const = 0;
+    virtual size_t count() const = 0;
+    virtual void clear() = 0;
+};
+
+/*
+ * The tree of the elements of the capacity `N`.
+ */
+template<size_t N>
+class c_bst_engine final : public c_bst_core
+{
+  public:
+    explicit c_bst_engine(const element_type* t) : type(t), tree() {}
+    c_bst_engine(const c_bst_engine&) = delete;
+    c_bst_engine& operator=(const c_bst_engine&) = delete;
+
+    int insert(const void* value) override
+    {
+        const unsigned int before = tree.count();
+        tree.insert(element<N>::make(type, value));
+        return tree.count() != before;
+    }
+    /*
+     * Sorts the elements and inserts the middle of each range before its halves,
+     * so the tree gets the height `log2(n)` instead of `n` for the sorted input.
+     */
+    size_t insert_n(const void* values, size_t n) override
+    {
+        const unsigned int before = tree.count();
+        element_iterator<N> first(type, values);
+        element_iterator<N> last(type, static_cast<const unsigned char*>(values) + n * type->size);
+        std::vector<element<N>> sorted(first, last);
+        std::sort(sorted.begin(), sorted.end());
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+        std::vector<std::pair<size_t, size_t>> ranges;
+        ranges.reserve(sorted.size());
+        ranges.emplace_back(0, sorted.size());
+        for(size_t i = 0; i < ranges.size(); i++) {
+            const size_t low = ranges[i].first, high = ranges[i].second;
+            if(low < high) {
+                const size_t middle = low + (high - low) / 2;
+                tree.insert(std::move(sorted[middle]));
+                ranges.emplace_back(low, middle);
+                ranges.emplace_back(middle + 1, high);
+            }
+        }
+        return tree.count() - before;
+    }
+    int find(const void* value) const override { return tree.find(element<N>::make(type, value)); }
+    int remove(const void* value) override
+    {
+        element<N> e = element<N>::make(type, value);
+        if(!tree.find(e)) {
+            return 0;
+        }
+        tree.remove(e);
+        return 1;
+    }
+    int min(void* buffer) const override
+    {
+        if(tree.is_empty()) {
+            return 0;
+        }
+        tree.min().copy_to(buffer);
+        return 1;
+    }
+    int max(void* buffer) const override
+    {
+        if(tree.is_empty()) {
+            return 0;
+        }
+        tree.max().copy_to(buffer);
+        return 1;
+    }
+    size_t to_array(void* buffer, size_t n) const override
+    {
+        unsigned char* out = static_cast<unsigned char*>(buffer);
+        size_t copied = 0;
+        for(auto it = tree.begin(); it != tree.end() && copied < n; ++it, ++copied) {
+            (*it).copy_to(out + copied * type->size);
+        }
+        return copied;
+    }
+    size_t count() const override { return tree.count(); }
+    void clear() override { tree.clear(); }
+
+  private:
+    const element_type* type; //! the type of the elements.
+    ::bst<element<N>> tree;   //! the tree.
+};
+
+/*
+ * The structure `c_bst`: the type of the elements and the tree.
+ */
+struct c_bst
+{
+    element_type type;
+    c_bst_core* core;
+};
+
+/*
+ * Creates a new tree, chooses the capacity of the elements by their size.
+ */
+c_bst* c_bst_create(size_t element_size, int (*compare)(const void*, const void*))
+{
+    c_bst* b = new c_bst{{element_size, compare, NULL}, NULL};
+    b->core = _helpers_type_erased::make_engine<c_bst_engine, c_bst_core>(&b->type);
+    if(b->core == NULL) {
+        delete b;
+        return NULL;
+    }
+    return b;
+}
+
+/*
+ * Inserts a copy of the element into the tree.
+ */
+int c_bst_insert(c_bst* b, const void* element)
+{
+    return b->core->insert(element);
+}
+
+/*
+ * Inserts the array of the elements into the tree.
+ */
+size_t c_bst_insert_n(c_bst* b, const void* elements, size_t n)
+{
+    return n ? b->core->insert_n(elements, n) : 0;
+}
+
+/*
+ * Looks for the element in the tree.
+ */
+int c_bst_find(const c_bst* b, const void* element)
+{
+    return b->core->find(element);
+}
+
+/*
+ * Removes the element from the tree.
+ */
+int c_bst_remove(c_bst* b, const void* element)
+{
+    return b->core->remove(element);
+}
+
+/*
+ * Copies the minimum element into the buffer.
+ */
+int c_bst_min(const c_bst* b, void* buffer)
+{
+    return b->core->min(buffer);
+}
+
+/*
+ * Copies the maximum element into the buffer.
+ */
+int c_bst_max(const c_bst* b, void* buffer)
+{
+    return b->core->max(buffer);
+}
+
+/*
+ * Copies the elements in the ascending order into the buffer.
+ */
+size_t c_bst_to_array(const c_bst* b, void* buffer, size_t n)
+{
+    return b->core->to_array(buffer, n);
+}
+
+/*
+ * Returns the number of elements.
+ */
+size_t c_bst_count(const c_bst* b)
+{
+    return b->core->count();
+}
+
+/*
+ * Removes all the elements from the tree.
+ */
+void c_bst_clear(c_bst* b)
+{
+    b->core->clear();
+}
+
+/*
+ * Removes the tree from memory.
+ */
+void c_bst_delete(c_bst* b)
+{
+    delete b->core;
+    delete b;
+}
+} // namespace pure_c
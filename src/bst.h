@@ -703,4 +703,103 @@ std::ostream& operator<<(std::ostream& stream, const bst<T>& tree)
 
 #endif /* __cplusplus */
 
+#include <stddef.h>
+
+/*
+ * A declaration the structure `c_bst` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The structure `c_bst`.
+     * The ordered set of the elements of the same size, which is implemented by the `bst` class.
+     * The elements are copied into the nodes of the tree and compared by the function of the user.
+     */
+    typedef struct c_bst c_bst;
+    /**
+     * Creates a new tree.
+     * @param element_size the size of each element, from `1` to `256` bytes.
+     * @param compare the comparison function: negative if the first element is less, `0` if the elements are equal,
+     * otherwise positive. If it is `NULL`, the bytes are compared by `memcmp`.
+     * @return a new tree, `NULL` if the size is wrong.
+     */
+    c_bst* c_bst_create(size_t element_size, int (*compare)(const void*, const void*));
+    /**
+     * Inserts a copy of the element into the tree.
+     * @param b a pointer to the tree.
+     * @param element a pointer to the element.
+     * @return `1` if the element is inserted, `0` if the tree already has such element.
+     */
+    int c_bst_insert(c_bst* b, const void* element);
+    /**
+     * Inserts the array of the elements into the tree.
+     * The elements are sorted and inserted from the middle, so the sorted array does not make the tree unbalanced.
+     * @param b a pointer to the tree.
+     * @param elements a pointer to the contiguous array of the elements.
+     * @param n the number of the elements.
+     * @return the number of the inserted elements.
+     */
+    size_t c_bst_insert_n(c_bst* b, const void* elements, size_t n);
+    /**
+     * Looks for the element in the tree.
+     * @param b a pointer to the tree.
+     * @param element a pointer to the element.
+     * @return `1` if the element is found, otherwise `0`.
+     */
+    int c_bst_find(const c_bst* b, const void* element);
+    /**
+     * Removes the element from the tree.
+     * @param b a pointer to the tree.
+     * @param element a pointer to the element.
+     * @return `1` if the element is removed, `0` if the tree has no such element.
+     */
+    int c_bst_remove(c_bst* b, const void* element);
+    /**
+     * Copies the minimum element into the buffer.
+     * @param b a pointer to the tree.
+     * @param buffer a pointer to the memory for the element.
+     * @return `1` if the element is copied, `0` if the tree is empty.
+     */
+    int c_bst_min(const c_bst* b, void* buffer);
+    /**
+     * Copies the maximum element into the buffer.
+     * @param b a pointer to the tree.
+     * @param buffer a pointer to the memory for the element.
+     * @return `1` if the element is copied, `0` if the tree is empty.
+     */
+    int c_bst_max(const c_bst* b, void* buffer);
+    /**
+     * Copies the elements in the ascending order into the buffer.
+     * @param b a pointer to the tree.
+     * @param buffer a pointer to the memory for `n` elements.
+     * @param n the maximum number of the elements.
+     * @return the number of the copied elements.
+     */
+    size_t c_bst_to_array(const c_bst* b, void* buffer, size_t n);
+    /**
+     * Returns the number of elements.
+     * @param b a pointer to the tree.
+     * @return the number of elements.
+     */
+    size_t c_bst_count(const c_bst* b);
+    /**
+     * Removes all the elements from the tree.
+     * @param b a pointer to the tree.
+     */
+    void c_bst_clear(c_bst* b);
+    /**
+     * Removes the tree from memory.
+     * @param b a pointer to the tree.
+     */
+    void c_bst_delete(c_bst* b);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* BST_H */
@@ -0,0 +1,246 @@
+/**
+ * @file concurrent_counter.h
+ *
+ * Contains the class `ConcurrentCounter`.
+ */
+#ifndef CONCURRENT_COUNTER_H
+#define CONCURRENT_COUNTER_H
+
+#ifdef __cplusplus
+#include "counter.h"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * This class counts the elements from several threads.
+ * The elements are distributed over the shards by the hash, each shard has its own map and lock,
+ * so the threads, which count different elements, do not wait for each other.
+ * The shards are aligned to the cache line, so the locks of different shards do not share cache lines.
+ * @tparam T type of the elements.
+ * @tparam SortFirst sort by first element or not, the same as `Counter`.
+ * @tparam Map type of the map of each shard, the same as `Counter`.
+ * @tparam Hash hash function, which chooses the shard.
+ */
+template<typename T, bool SortFirst = true, typename Map = std::unordered_map<T, unsigned int>, typename Hash = std::hash<T>>
+class ConcurrentCounter
+{
+  public:
+    /**
+     * Counter type, which is returned by the `snapshot` function.
+     */
+    using counter_t = Counter<T, SortFirst, Map>;
+    /**
+     * Map type: key - the element, value - the number of such elements.
+     */
+    using map_t = Map;
+
+  public:
+    /**
+     * Constructor.
+     * @param shards the number of shards, rounded up to the power of two.
+     * `0` - four shards for each hardware thread.
+     */
+    explicit ConcurrentCounter(std::size_t shards = 0);
+    /**
+     * Constructor, counts the elements of the sequence.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     * @param shards the number of shards.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    ConcurrentCounter(IteratorBegin _begin, IteratorEnd _end, std::size_t shards = 0);
+    /**
+     * The class is not copyable.
+     */
+    ConcurrentCounter(const ConcurrentCounter&) = delete;
+    ConcurrentCounter& operator=(const ConcurrentCounter&) = delete;
+    /**
+     * Destructor.
+     */
+    virtual ~ConcurrentCounter() = default;
+    /**
+     * Adds the number to the element. Can be called from any thread.
+     * @param element an element.
+     * @param delta the number, by default is `1`.
+     */
+    void increment(const T& element, unsigned int delta = 1);
+    /**
+     * Counts new elements. Can be called from any thread.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    void update(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Returns the number of the element.
+     * @param element an element.
+     * @return the number, `0` if the element was not counted.
+     */
+    unsigned int count(const T& element) const;
+    /**
+     * Copies the numbers of all shards into a new counter.
+     * Each shard is locked in turn, so the increments in other threads are not stopped.
+     * @return the counter, which can be sorted by `most_common`.
+     */
+    counter_t snapshot() const;
+    /**
+     * Removes all the elements.
+     */
+    void clear();
+    /**
+     * @return the number of different elements.
+     */
+    std::size_t size() const;
+    /**
+     * @return the number of shards.
+     */
+    inline std::size_t shards() const noexcept { return _shards.size(); }
+
+  private:
+    /**
+     * The size of the cache line.
+     */
+    static constexpr std::size_t cache_line = 64;
+    /**
+     * The shard: the map and its lock.
+     */
+    struct alignas(cache_line) Shard
+    {
+        std::mutex lock{}; //! the lock of the map.
+        map_t map{};       //! the numbers of the elements.
+    };
+    /**
+     * Returns the shard of the element.
+     */
+    inline Shard& shard(const T& element) const
+    {
+        auto h = static_cast<std::uint64_t>(Hash{}(element)) * 0x9E3779B97F4A7C15ull;
+        return _shards[static_cast<std::size_t>(h >> 32) & (_shards.size() - 1)];
+    }
+    /**
+     * Returns the number of shards: rounded up to the power of two.
+     */
+    static std::size_t calc_shards(std::size_t shards);
+
+  private:
+    mutable std::vector<Shard> _shards; //! the shards.
+};
+
+/*
+ * Constructor.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+ConcurrentCounter<T, SortFirst, Map, Hash>::ConcurrentCounter(std::size_t shards) : _shards(calc_shards(shards))
+{}
+
+/*
+ * Constructor.
+ * Counts the elements of the sequence.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+template<typename IteratorBegin, typename IteratorEnd>
+ConcurrentCounter<T, SortFirst, Map, Hash>::ConcurrentCounter(IteratorBegin _begin, IteratorEnd _end, std::size_t shards) :
+    ConcurrentCounter(shards)
+{
+    update(_begin, _end);
+}
+
+/*
+ * The `increment` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+void ConcurrentCounter<T, SortFirst, Map, Hash>::increment(const T& element, unsigned int delta)
+{
+    Shard& s = shard(element);
+    std::lock_guard<std::mutex> guard(s.lock);
+    s.map[element] += delta;
+}
+
+/*
+ * The `update` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+template<typename IteratorBegin, typename IteratorEnd>
+void ConcurrentCounter<T, SortFirst, Map, Hash>::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    for(auto it = _begin; it != _end; it++) {
+        increment(*it);
+    }
+}
+
+/*
+ * The `count` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+unsigned int ConcurrentCounter<T, SortFirst, Map, Hash>::count(const T& element) const
+{
+    Shard& s = shard(element);
+    std::lock_guard<std::mutex> guard(s.lock);
+    return s.map.count(element) ? s.map[element] : 0;
+}
+
+/*
+ * The `snapshot` function.
+ * The shards have different elements, so the maps are merged without the addition.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+typename ConcurrentCounter<T, SortFirst, Map, Hash>::counter_t ConcurrentCounter<T, SortFirst, Map, Hash>::snapshot() const
+{
+    map_t result;
+    for(Shard& s : _shards) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        for(const auto& p : s.map) {
+            result[p.first] = p.second;
+        }
+    }
+    return counter_t(std::move(result));
+}
+
+/*
+ * The `clear` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+void ConcurrentCounter<T, SortFirst, Map, Hash>::clear()
+{
+    for(Shard& s : _shards) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        s.map.clear();
+    }
+}
+
+/*
+ * The `size` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+std::size_t ConcurrentCounter<T, SortFirst, Map, Hash>::size() const
+{
+    std::size_t result = 0;
+    for(Shard& s : _shards) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        result += s.map.size();
+    }
+    return result;
+}
+
+/*
+ * The `calc_shards` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Hash>
+std::size_t ConcurrentCounter<T, SortFirst, Map, Hash>::calc_shards(std::size_t shards)
+{
+    if(!shards) {
+        shards = 4 * std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    std::size_t result = 1;
+    while(result < shards) {
+        result <<= 1;
+    }
+    return result;
+}
+
+#endif /* __cplusplus */
+
+#endif /* CONCURRENT_COUNTER_H */
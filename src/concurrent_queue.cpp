@@ -0,0 +1,204 @@
+#include "concurrent_queue.h"
+#include "extensions.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace pure_c
+{
+/*
+ * The size of the cache line.
+ */
+static const size_t concurrent_queue_cache_line = 64;
+
+/*
+ * The node of the queue, the element follows it in the same memory block.
+ */
+struct concurrent_queue_node
+{
+    std::atomic<concurrent_queue_node*> next; //! the next node, is set by the producer under the lock of the back.
+    size_t length;                            //! the length of the element.
+};
+
+/*
+ * The queue: the front and the back are on different cache lines, as their locks.
+ */
+struct concurrent_queue
+{
+    alignas(concurrent_queue_cache_line) std::mutex front_lock{};      //! the lock of the consumers.
+    concurrent_queue_node* front{NULL};                                //! the dummy node, the first element follows it.
+    std::condition_variable not_empty{};                               //! the consumers wait for the elements.
+    std::atomic<size_t> waiting{0};                                    //! the number of waiting consumers.
+    alignas(concurrent_queue_cache_line) std::mutex back_lock{};       //! the lock of the producers.
+    concurrent_queue_node* back{NULL};                                 //! the last node.
+    alignas(concurrent_queue_cache_line) std::atomic<size_t> count{0}; //! the number of elements.
+};
+
+/*
+ * Returns the pointer to the element of the node.
+ */
+static inline char* concurrent_queue_value(concurrent_queue_node* node)
+{
+    return (char*)node + pure_c::inline_value_offset(sizeof(concurrent_queue_node));
+}
+
+/*
+ * Allocates a node with the element.
+ */
+static concurrent_queue_node* concurrent_queue_alloc(const void* element, size_t length)
+{
+    const size_t offset = pure_c::inline_value_offset(sizeof(concurrent_queue_node));
+    concurrent_queue_node* node = new(std::malloc(offset + length)) concurrent_queue_node{{NULL}, length};
+    if(length) {
+        std::memcpy(concurrent_queue_value(node), element, length);
+    }
+    return node;
+}
+
+/*
+ * Frees the node.
+ */
+static inline void concurrent_queue_free(concurrent_queue_node* node)
+{
+    node->~concurrent_queue_node();
+    free(node);
+}
+
+/*
+ * Creates a new queue with the dummy node.
+ */
+concurrent_queue* concurrent_queue_create()
+{
+    concurrent_queue* q = new concurrent_queue();
+    q->front = q->back = concurrent_queue_alloc(NULL, 0);
+    return q;
+}
+
+/*
+ * Links the new node after the last node.
+ * The consumers read the `next` field without the lock of the back,
+ * so the node is published by the release store.
+ * The empty element is not inserted: `0` is the result of `dequeue` for the empty queue.
+ */
+int concurrent_queue_enqueue(concurrent_queue* q, const void* element, size_t length)
+{
+    if(!length) {
+        return 0;
+    }
+    concurrent_queue_node* node = concurrent_queue_alloc(element, length);
+    // the number is increased before, so it is never less than the number of elements.
+    q->count.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(q->back_lock);
+        q->back->next.store(node, std::memory_order_seq_cst);
+        q->back = node;
+    }
+    // the consumer increases `waiting` before it checks the queue the last time, so it is not missed.
+    if(q->waiting.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(q->front_lock);
+        q->not_empty.notify_one();
+    }
+    return 1;
+}
+
+/*
+ * Removes the first element under the lock of the front.
+ * The old dummy node is returned to be freed after the lock, the node of the element becomes the dummy node.
+ */
+static size_t concurrent_queue_take(concurrent_queue* q, void* buffer, size_t capacity, concurrent_queue_node** old)
+{
+    concurrent_queue_node* next = q->front->next.load(std::memory_order_seq_cst);
+    if(next == NULL) {
+        return 0;
+    }
+    if(next->length > capacity) {
+        return next->length;
+    }
+    std::memcpy(buffer, concurrent_queue_value(next), next->length);
+    *old = q->front;
+    q->front = next;
+    q->count.fetch_sub(1, std::memory_order_relaxed);
+    return next->length;
+}
+
+/*
+ * Removes the first element without waiting.
+ */
+size_t concurrent_queue_dequeue_into(concurrent_queue* q, void* buffer, size_t capacity)
+{
+    concurrent_queue_node* old = NULL;
+    size_t length = 0;
+    {
+        std::lock_guard<std::mutex> lock(q->front_lock);
+        length = concurrent_queue_take(q, buffer, capacity, &old);
+    }
+    if(old != NULL) {
+        concurrent_queue_free(old);
+    }
+    return length;
+}
+
+/*
+ * Removes the first element, waits on the condition variable, while the queue is empty.
+ */
+size_t concurrent_queue_wait_dequeue(concurrent_queue* q, void* buffer, size_t capacity, int timeout_ms)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms);
+    concurrent_queue_node* old = NULL;
+    size_t length = 0;
+    {
+        std::unique_lock<std::mutex> lock(q->front_lock);
+        bool yielded = false;
+        while((length = concurrent_queue_take(q, buffer, capacity, &old)) == 0) {
+            if(!yielded) {
+                // the producer is often in the middle of the insertion, gives it the time before sleeping.
+                yielded = true;
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+                continue;
+            }
+            q->waiting.fetch_add(1, std::memory_order_seq_cst);
+            if(q->front->next.load(std::memory_order_seq_cst) == NULL) {
+                if(timeout_ms < 0) {
+                    q->not_empty.wait(lock);
+                } else if(q->not_empty.wait_until(lock, deadline) == std::cv_status::timeout) {
+                    q->waiting.fetch_sub(1, std::memory_order_seq_cst);
+                    length = concurrent_queue_take(q, buffer, capacity, &old);
+                    break;
+                }
+            }
+            q->waiting.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+    if(old != NULL) {
+        concurrent_queue_free(old);
+    }
+    return length;
+}
+
+/*
+ * Returns the number of elements.
+ */
+size_t concurrent_queue_count(const concurrent_queue* q)
+{
+    return q->count.load(std::memory_order_relaxed);
+}
+
+/*
+ * Removes the queue and all the nodes from memory.
+ */
+void concurrent_queue_delete(concurrent_queue* q)
+{
+    concurrent_queue_node* node = q->front;
+    while(node != NULL) {
+        concurrent_queue_node* next = node->next.load(std::memory_order_relaxed);
+        concurrent_queue_free(node);
+        node = next;
+    }
+    delete q;
+}
+} // namespace pure_c
@@ -0,0 +1,80 @@
+/**
+ * @file concurrent_queue.h
+ *
+ * Contains the thread-safe queue `concurrent_queue` for C.
+ */
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <stddef.h>
+
+/*
+ * A declaration the structure `concurrent_queue` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The structure `concurrent_queue`.
+     * The queue "First-In-First-Out", which is used by several threads without the external lock.
+     * The queue has two locks: the producers take only the lock of the back, the consumers take only
+     * the lock of the front, so the insertion and the removing do not wait for each other.
+     * The first node is the dummy node, so the removed node is never used by the producers and is freed at once.
+     * The element is stored in the same memory block as its node.
+     */
+    typedef struct concurrent_queue concurrent_queue;
+    /**
+     * Creates a new queue.
+     * @return a new queue.
+     */
+    concurrent_queue* concurrent_queue_create(void);
+    /**
+     * Inserts a copy of the element into the queue and wakes up a waiting consumer.
+     * @param q a pointer to the queue.
+     * @param element a pointer to the element.
+     * @param length the length of the element, not `0`.
+     * @return `1` if the element is inserted, `0` if the length is `0`.
+     */
+    int concurrent_queue_enqueue(concurrent_queue* q, const void* element, size_t length);
+    /**
+     * Removes the first element from the queue without waiting and copies it into the buffer.
+     * If the buffer is less than the element, the element is not removed.
+     * @param q a pointer to the queue.
+     * @param buffer a pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @return the length of the element, `0` if the queue is empty.
+     * If the result is more than the capacity, the element was not copied.
+     */
+    size_t concurrent_queue_dequeue_into(concurrent_queue* q, void* buffer, size_t capacity);
+    /**
+     * Removes the first element from the queue, waits for an element, if the queue is empty.
+     * @param q a pointer to the queue.
+     * @param buffer a pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @param timeout_ms the maximum time of waiting in milliseconds, negative - without the limit.
+     * @return the length of the element, `0` if the time is over.
+     */
+    size_t concurrent_queue_wait_dequeue(concurrent_queue* q, void* buffer, size_t capacity, int timeout_ms);
+    /**
+     * Returns the number of elements.
+     * The result is approximate, if other threads change the queue.
+     * @param q a pointer to the queue.
+     * @return the number of elements.
+     */
+    size_t concurrent_queue_count(const concurrent_queue* q);
+    /**
+     * Removes the queue from memory.
+     * The queue must not be used by other threads.
+     * @param q a pointer to the queue.
+     */
+    void concurrent_queue_delete(concurrent_queue* q);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CONCURRENT_QUEUE_H */
@@ -0,0 +1,174 @@
+#include "concurrent_stack.h"
+#include "extensions.h"
+#include <atomic>
+#include <new>
+
+namespace pure_c
+{
+/*
+ * The size of the cache line.
+ */
+static const size_t concurrent_stack_cache_line = 64;
+
+/*
+ * The node of the stack, the element follows it in the same memory block.
+ * The `next` field is atomic: the removed node is linked into the list of the pending nodes,
+ * while another thread can read it.
+ */
+struct concurrent_stack_node
+{
+    std::atomic<concurrent_stack_node*> next; //! the next node.
+    size_t length;                            //! the length of the element.
+};
+
+/*
+ * The stack: the first node, the number of elements and the reclamation state are on different cache lines.
+ */
+struct concurrent_stack
+{
+    alignas(concurrent_stack_cache_line) std::atomic<concurrent_stack_node*> front{NULL}; //! the first node.
+    alignas(concurrent_stack_cache_line) std::atomic<size_t> count{0};                   //! the number of elements.
+    alignas(concurrent_stack_cache_line) std::atomic<unsigned int> threads_in_pop{0};    //! the number of removing threads.
+    std::atomic<concurrent_stack_node*> pending{NULL};                                   //! the removed nodes, which are not freed.
+};
+
+/*
+ * Returns the pointer to the element of the node.
+ */
+static inline char* concurrent_stack_value(concurrent_stack_node* node)
+{
+    return (char*)node + pure_c::inline_value_offset(sizeof(concurrent_stack_node));
+}
+
+/*
+ * Frees the list of the nodes.
+ */
+static void concurrent_stack_free(concurrent_stack_node* node)
+{
+    while(node != NULL) {
+        concurrent_stack_node* next = node->next.load(std::memory_order_relaxed);
+        node->~concurrent_stack_node();
+        free(node);
+        node = next;
+    }
+}
+
+/*
+ * Adds the list of the nodes from `first` to `last` to the pending nodes.
+ */
+static void concurrent_stack_chain(concurrent_stack* s, concurrent_stack_node* first, concurrent_stack_node* last)
+{
+    concurrent_stack_node* pending = s->pending.load(std::memory_order_relaxed);
+    do {
+        last->next.store(pending, std::memory_order_relaxed);
+    } while(!s->pending.compare_exchange_weak(pending, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/*
+ * Frees the removed node or adds it to the pending nodes.
+ * If the current thread is the only one in `pop`, no thread can read the node and the pending nodes,
+ * which were added before this check, so they are freed.
+ */
+static void concurrent_stack_reclaim(concurrent_stack* s, concurrent_stack_node* node)
+{
+    if(s->threads_in_pop.load(std::memory_order_seq_cst) == 1) {
+        concurrent_stack_node* pending = s->pending.exchange(NULL, std::memory_order_acq_rel);
+        if(s->threads_in_pop.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+            concurrent_stack_free(pending);
+        } else if(pending != NULL) {
+            // another thread came into `pop` and may read these nodes.
+            concurrent_stack_node* last = pending;
+            while(last->next.load(std::memory_order_relaxed) != NULL) {
+                last = last->next.load(std::memory_order_relaxed);
+            }
+            concurrent_stack_chain(s, pending, last);
+        }
+        node->next.store(NULL, std::memory_order_relaxed);
+        concurrent_stack_free(node);
+    } else {
+        concurrent_stack_chain(s, node, node);
+        s->threads_in_pop.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+/*
+ * Creates a new stack.
+ */
+concurrent_stack* concurrent_stack_create()
+{
+    return new concurrent_stack();
+}
+
+/*
+ * Inserts the node before the first node by the compare-and-swap.
+ * The empty element is not inserted: `0` is the result of `pop` for the empty stack.
+ */
+int concurrent_stack_push(concurrent_stack* s, const void* element, size_t length)
+{
+    if(!length) {
+        return 0;
+    }
+    const size_t offset = pure_c::inline_value_offset(sizeof(concurrent_stack_node));
+    concurrent_stack_node* node = new(std::malloc(offset + length)) concurrent_stack_node{{NULL}, length};
+    std::memcpy(concurrent_stack_value(node), element, length);
+    // the number is increased before, so it is never less than the number of elements.
+    s->count.fetch_add(1, std::memory_order_relaxed);
+    concurrent_stack_node* front = s->front.load(std::memory_order_relaxed);
+    do {
+        node->next.store(front, std::memory_order_relaxed);
+    } while(!s->front.compare_exchange_weak(front, node, std::memory_order_release, std::memory_order_relaxed));
+    return 1;
+}
+
+/*
+ * Removes the first node by the compare-and-swap and copies its element.
+ * The node cannot be freed by another thread, while this thread is counted in `threads_in_pop`.
+ * The load and the swing of the first node are sequentially consistent, as the counter of the removing threads:
+ * the thread, which frees the node, either sees this thread in `threads_in_pop` or this thread sees the new first node.
+ */
+size_t concurrent_stack_pop_into(concurrent_stack* s, void* buffer, size_t capacity)
+{
+    s->threads_in_pop.fetch_add(1, std::memory_order_seq_cst);
+    concurrent_stack_node* front = s->front.load(std::memory_order_seq_cst);
+    while(front != NULL) {
+        if(front->length > capacity) {
+            const size_t length = front->length;
+            s->threads_in_pop.fetch_sub(1, std::memory_order_seq_cst);
+            return length;
+        }
+        if(s->front.compare_exchange_weak(front,
+                                          front->next.load(std::memory_order_relaxed),
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_seq_cst)) {
+            break;
+        }
+    }
+    if(front == NULL) {
+        s->threads_in_pop.fetch_sub(1, std::memory_order_seq_cst);
+        return 0;
+    }
+    const size_t length = front->length;
+    std::memcpy(buffer, concurrent_stack_value(front), length);
+    s->count.fetch_sub(1, std::memory_order_relaxed);
+    concurrent_stack_reclaim(s, front);
+    return length;
+}
+
+/*
+ * Returns the number of elements.
+ */
+size_t concurrent_stack_count(const concurrent_stack* s)
+{
+    return s->count.load(std::memory_order_relaxed);
+}
+
+/*
+ * Removes the stack, all the nodes and the pending nodes from memory.
+ */
+void concurrent_stack_delete(concurrent_stack* s)
+{
+    concurrent_stack_free(s->front.load(std::memory_order_relaxed));
+    concurrent_stack_free(s->pending.load(std::memory_order_relaxed));
+    delete s;
+}
+} // namespace pure_c
@@ -0,0 +1,71 @@
+/**
+ * @file concurrent_stack.h
+ *
+ * Contains the thread-safe stack `concurrent_stack` for C.
+ */
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <stddef.h>
+
+/*
+ * A declaration the structure `concurrent_stack` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The structure `concurrent_stack`.
+     * The stack "Last-In-First-Out", which is used by several threads without locks (the Treiber stack):
+     * the first node is changed by the atomic compare-and-swap.
+     * The removed node can be read by another thread, which removes the element at the same time,
+     * so the node is freed only when no other thread removes an element, otherwise it is freed later.
+     * The element is stored in the same memory block as its node.
+     */
+    typedef struct concurrent_stack concurrent_stack;
+    /**
+     * Creates a new stack.
+     * @return a new stack.
+     */
+    concurrent_stack* concurrent_stack_create(void);
+    /**
+     * Inserts a copy of the element into the stack.
+     * @param s a pointer to the stack.
+     * @param element a pointer to the element.
+     * @param length the length of the element, not `0`.
+     * @return `1` if the element is inserted, `0` if the length is `0`.
+     */
+    int concurrent_stack_push(concurrent_stack* s, const void* element, size_t length);
+    /**
+     * Removes the first element from the stack and copies it into the buffer.
+     * If the buffer is less than the element, the element is not removed.
+     * @param s a pointer to the stack.
+     * @param buffer a pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @return the length of the element, `0` if the stack is empty.
+     * If the result is more than the capacity, the element was not copied.
+     */
+    size_t concurrent_stack_pop_into(concurrent_stack* s, void* buffer, size_t capacity);
+    /**
+     * Returns the number of elements.
+     * The result is approximate, if other threads change the stack.
+     * @param s a pointer to the stack.
+     * @return the number of elements.
+     */
+    size_t concurrent_stack_count(const concurrent_stack* s);
+    /**
+     * Removes the stack from memory.
+     * The stack must not be used by other threads.
+     * @param s a pointer to the stack.
+     */
+    void concurrent_stack_delete(concurrent_stack* s);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CONCURRENT_STACK_H */
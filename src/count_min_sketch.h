@@ -0,0 +1,286 @@
+/**
+ * @file count_min_sketch.h
+ *
+ * Contains the class `CountMinSketch`.
+ */
+#ifndef COUNT_MIN_SKETCH_H
+#define COUNT_MIN_SKETCH_H
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * The `CountMinSketch` class.
+ * This class estimates the number of elements in a sequence using the Count-Min sketch.
+ * The sketch is a table of `depth` rows and `width` columns, each element increments
+ * one counter in each row. The estimated number is the minimum of these counters,
+ * so the estimate is never less than the real number.
+ * The memory is fixed: it depends on `epsilon` and `delta` only, not on the sequence.
+ *
+ * Guarantees: `estimate(e) <= the real number + epsilon * total()` with probability `1 - delta`.
+ * @tparam T type of the sequence.
+ * @tparam Conservative use the conservative update: increments only the minimum counters.
+ * The estimate is more accurate, but the update is a bit slower.
+ * @tparam Hash hash function.
+ */
+template<typename T, bool Conservative = false, typename Hash = std::hash<T>>
+class CountMinSketch
+{
+  public:
+    /**
+     * Constructor.
+     * If `epsilon` or `delta` is not in the range `(0, 1)`, throws the `invalid_argument` exception.
+     * @param epsilon the relative error of the estimate, the width is `e / epsilon`
+     * (rounded up to the power of two).
+     * @param delta the probability of the larger error, the depth is `ln(1 / delta)`.
+     */
+    CountMinSketch(double epsilon, double delta);
+    /**
+     * Constructor, counts the elements of the sequence.
+     * @param epsilon the relative error of the estimate.
+     * @param delta the probability of the larger error.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    CountMinSketch(double epsilon, double delta, IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Destructor.
+     */
+    virtual ~CountMinSketch() = default;
+    /**
+     * Counts new elements.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    void update(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Counts a new element.
+     * @param element a new element.
+     */
+    void push(const T& element);
+    /**
+     * Returns the estimated number of the element, an upper bound of the real number.
+     * @param element an element.
+     * @return the estimated number.
+     */
+    unsigned int estimate(const T& element) const;
+    /**
+     * Adds the counters of another sketch. The result is the sketch of both sequences.
+     * If the sketches have different sizes, throws the `invalid_argument` exception.
+     * @param other another sketch, created with the same `epsilon` and `delta`.
+     */
+    void merge(const CountMinSketch& other);
+    /**
+     * Resets all the counters.
+     */
+    void clear() noexcept;
+    /**
+     * @return the number of counted elements, including repeated elements.
+     */
+    inline unsigned long total() const noexcept { return _total; }
+    /**
+     * @return the number of columns.
+     */
+    inline std::size_t width() const noexcept { return _mask + 1; }
+    /**
+     * @return the number of rows.
+     */
+    inline std::size_t depth() const noexcept { return _depth; }
+
+  private:
+    /**
+     * Calculates the column of the element in each row.
+     * The columns are calculated by the double hashing: `h1 + row * h2`.
+     */
+    void columns(const T& element, std::size_t* cols) const;
+    /**
+     * Mixes the bits of the hash.
+     */
+    static inline std::uint64_t mix(std::uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return h;
+    }
+    /**
+     * Returns the number of columns: `e / epsilon`, rounded up to the power of two.
+     */
+    static std::size_t calc_width(double epsilon);
+    /**
+     * Returns the number of rows: `ln(1 / delta)`.
+     */
+    static std::size_t calc_depth(double delta);
+
+  private:
+    /**
+     * The maximum number of rows.
+     */
+    static constexpr std::size_t max_depth = 32;
+
+    std::size_t _mask{0};                  //! the number of columns minus one.
+    std::size_t _depth{0};                 //! the number of rows.
+    std::vector<unsigned int> _counters{}; //! the rows, one after another.
+    unsigned long _total{0};               //! the number of counted elements.
+};
+
+/*
+ * Constructor.
+ */
+template<typename T, bool Conservative, typename Hash>
+CountMinSketch<T, Conservative, Hash>::CountMinSketch(double epsilon, double delta) :
+    _mask(calc_width(epsilon) - 1), _depth(calc_depth(delta)), _counters((_mask + 1) * _depth, 0)
+{
+}
+
+/*
+ * Constructor.
+ * Counts the elements of the sequence.
+ */
+template<typename T, bool Conservative, typename Hash>
+template<typename IteratorBegin, typename IteratorEnd>
+CountMinSketch<T, Conservative, Hash>::CountMinSketch(double epsilon, double delta, IteratorBegin _begin,
+                                                      IteratorEnd _end) :
+    CountMinSketch(epsilon, delta)
+{
+    update(_begin, _end);
+}
+
+/*
+ * The `update` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+template<typename IteratorBegin, typename IteratorEnd>
+void CountMinSketch<T, Conservative, Hash>::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    for(auto it = _begin; it != _end; it++) {
+        push(*it);
+    }
+}
+
+/*
+ * The `push` function.
+ * The columns are calculated first, so the rows are updated by a loop without the hashing.
+ */
+template<typename T, bool Conservative, typename Hash>
+void CountMinSketch<T, Conservative, Hash>::push(const T& element)
+{
+    std::size_t cols[max_depth];
+    columns(element, cols);
+    unsigned int* row = _counters.data();
+    if constexpr(Conservative) {
+        unsigned int min = row[cols[0]];
+        for(std::size_t i = 1; i < _depth; i++) {
+            min = std::min(min, row[i * width() + cols[i]]);
+        }
+        for(std::size_t i = 0; i < _depth; i++) {
+            unsigned int& c = row[i * width() + cols[i]];
+            c = std::max(c, min + 1);
+        }
+    } else {
+        for(std::size_t i = 0; i < _depth; i++) {
+            row[i * width() + cols[i]]++;
+        }
+    }
+    _total++;
+}
+
+/*
+ * The `estimate` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+unsigned int CountMinSketch<T, Conservative, Hash>::estimate(const T& element) const
+{
+    std::size_t cols[max_depth];
+    columns(element, cols);
+    unsigned int min = _counters[cols[0]];
+    for(std::size_t i = 1; i < _depth; i++) {
+        min = std::min(min, _counters[i * width() + cols[i]]);
+    }
+    return min;
+}
+
+/*
+ * The `merge` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+void CountMinSketch<T, Conservative, Hash>::merge(const CountMinSketch& other)
+{
+    if(width() != other.width() || _depth != other._depth) {
+        throw std::invalid_argument("Error: the sketches have different sizes.");
+    }
+    unsigned int* dst = _counters.data();
+    const unsigned int* src = other._counters.data();
+    for(std::size_t i = 0, n = _counters.size(); i < n; i++) {
+        dst[i] += src[i];
+    }
+    _total += other._total;
+}
+
+/*
+ * The `clear` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+void CountMinSketch<T, Conservative, Hash>::clear() noexcept
+{
+    std::fill(_counters.begin(), _counters.end(), 0u);
+    _total = 0;
+}
+
+/*
+ * The `columns` function.
+ * The second hash is odd, so the columns of different rows are different.
+ */
+template<typename T, bool Conservative, typename Hash>
+void CountMinSketch<T, Conservative, Hash>::columns(const T& element, std::size_t* cols) const
+{
+    std::uint64_t h = mix(static_cast<std::uint64_t>(Hash{}(element)));
+    std::uint64_t h1 = h;
+    std::uint64_t h2 = mix(h ^ 0x9E3779B97F4A7C15ull) | 1;
+    for(std::size_t i = 0; i < _depth; i++) {
+        cols[i] = static_cast<std::size_t>(h1 + i * h2) & _mask;
+    }
+}
+
+/*
+ * The `calc_width` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+std::size_t CountMinSketch<T, Conservative, Hash>::calc_width(double epsilon)
+{
+    if(!(epsilon > 0.0 && epsilon < 1.0)) {
+        throw std::invalid_argument("Error: epsilon must be in the range (0, 1).");
+    }
+    auto w = static_cast<std::size_t>(std::ceil(std::exp(1.0) / epsilon));
+    std::size_t width = 1;
+    while(width < w) {
+        width <<= 1;
+    }
+    return width;
+}
+
+/*
+ * The `calc_depth` function.
+ */
+template<typename T, bool Conservative, typename Hash>
+std::size_t CountMinSketch<T, Conservative, Hash>::calc_depth(double delta)
+{
+    if(!(delta > 0.0 && delta < 1.0)) {
+        throw std::invalid_argument("Error: delta must be in the range (0, 1).");
+    }
+    auto d = static_cast<std::size_t>(std::ceil(std::log(1.0 / delta)));
+    return std::min(std::max(d, std::size_t(1)), max_depth);
+}
+
+#endif /* __cplusplus */
+
+#endif /* COUNT_MIN_SKETCH_H */
@@ -1,4 +1,137 @@
 /*
  * This file required to create the `.so` library.
+ * Also, it contains the C interface of the `Counter` class.
  */
-#include "counter.h"
\ No newline at end of file
+#include "counter.h"
+#include "type_erased.h"
+#include <algorithm>
+
+namespace pure_c
+{
+using _helpers_type_erased::element;
+using _helpers_type_erased::element_hash;
+using _helpers_type_erased::element_iterator;
+using _helpers_type_erased::element_type;
+
+/*
+ * The interface of the counters, which store the elements of the different capacities.
+ */
+struct c_counter_core
+{
+    virtual ~c_counter_core() = default;
+    virtual void add(const void* value) = 0;
+    virtual void add_n(const void* values, size_t n) = 0;
+    virtual size_t most_common(size_t n, void* values, unsigned int* counts) = 0;
+    virtual size_t size() const = 0;
+};
+
+/*
+ * The counter of the elements of the capacity `N`.
+ */
+template<size_t N>
+class c_counter_engine final : public c_counter_core
+{
+    using map_t = std::unordered_map<element<N>, unsigned int, element_hash<N>>;
+
+  public:
+    explicit c_counter_engine(const element_type* t) : type(t), counter(map_t()) {}
+    c_counter_engine(const c_counter_engine&) = delete;
+    c_counter_engine& operator=(const c_counter_engine&) = delete;
+
+    void add(const void* value) override
+    {
+        element<N> e = element<N>::make(type, value);
+        counter.update(&e, &e + 1);
+    }
+    void add_n(const void* values, size_t n) override
+    {
+        element_iterator<N> first(type, values);
+        element_iterator<N> last(type, static_cast<const unsigned char*>(values) + n * type->size);
+        counter.update(first, last);
+    }
+    size_t most_common(size_t n, void* values, unsigned int* counts) override
+    {
+        n = std::min<size_t>(n, counter.size());
+        auto pairs = counter.most_common(static_cast<int>(n));
+        unsigned char* out = static_cast<unsigned char*>(values);
+        for(size_t i = 0; i < pairs.size(); i++) {
+            pairs[i].first.copy_to(out + i * type->size);
+            if(counts != NULL) {
+                counts[i] = pairs[i].second;
+            }
+        }
+        return pairs.size();
+    }
+    size_t size() const override { return counter.size(); }
+
+  private:
+    const element_type* type;                 //! the type of the elements.
+    Counter<element<N>, true, map_t> counter; //! the counter.
+};
+
+/*
+ * The structure `c_counter`: the type of the elements and the counter.
+ */
+struct c_counter
+{
+    element_type type;
+    c_counter_core* core;
+};
+
+/*
+ * Creates a new counter, chooses the capacity of the elements by their size.
+ */
+c_counter* c_counter_create(size_t element_size, size_t (*hash)(const void*), int (*compare)(const void*, const void*))
+{
+    c_counter* c = new c_counter{{element_size, compare, hash}, NULL};
+    c->core = _helpers_type_erased::make_engine<c_counter_engine, c_counter_core>(&c->type);
+    if(c->core == NULL) {
+        delete c;
+        return NULL;
+    }
+    return c;
+}
+
+/*
+ * Counts the element.
+ */
+void c_counter_add(c_counter* c, const void* element)
+{
+    c->core->add(element);
+}
+
+/*
+ * Counts the array of the elements.
+ */
+void c_counter_add_n(c_counter* c, const void* elements, size_t n)
+{
+    if(n) {
+        c->core->add_n(elements, n);
+    }
+}
+
+/*
+ * Copies the most common elements and their numbers.
+ */
+size_t c_counter_most_common(c_counter* c, size_t n, void* elements, unsigned int* counts)
+{
+    return c->core->most_common(n, elements, counts);
+}
+
+/*
+ * Returns the number of the different elements.
+ */
+size_t c_counter_size(const c_counter* c)
+{
+    return c->core->size();
+}
+
+/*
+ * Removes the counter from memory.
+ */
+void c_counter_delete(c_counter* c)
+{
+    delete c->core;
+    delete c;
+}
+} // namespace pure_c
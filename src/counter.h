@@ -7,6 +7,8 @@
 #define COUNTER_H
 
 #ifdef __cplusplus
+#include "flat_map.h"
+#include "dense_map.h"
 #include <initializer_list>
 #include <unordered_map>
 #include <vector>
@@ -14,20 +16,41 @@
 #include <algorithm>
 #include <iterator>
 #include <ostream>
+#include <thread>
+#include <exception>
+#include <type_traits>
+
+namespace _helpers_counter
+{
+/**
+ * Checks that the map has the `add(first, last)` function, which counts a sequence.
+ * This is helper struct. Do not use this.
+ */
+template<typename M, typename Iterator, typename = void>
+struct has_add : std::false_type
+{};
+template<typename M, typename Iterator>
+struct has_add<M, Iterator, std::void_t<decltype(std::declval<M&>().add(std::declval<Iterator>(), std::declval<Iterator>()))>>
+    : std::true_type
+{};
+} // namespace _helpers_counter
 
 /**
  * This class counts number of elements from a some sequence
  * @tparam T type of the sequence.
  * @tparam SortFirst sort by first element or not.
+ * @tparam Map type of the map, which counts elements. For example: `std::unordered_map<T, unsigned int>`
+ * or `FlatMap<T, unsigned int>`. The map must have the operator `[]`, `begin`, `end` and `size` functions.
+ * If the map has the `add(first, last)` function (for example, `DenseMap<T>`), the sequences are counted by it.
  */
-template<typename T, bool SortFirst = true>
+template<typename T, bool SortFirst = true, typename Map = std::unordered_map<T, unsigned int>>
 class Counter
 {
     /**
      * Makes the overloaded operator `<<` friend.
      */
-    template<typename Type>
-    friend std::ostream& operator<<(std::ostream& stream, const Counter<Type>& c);
+    template<typename Type, bool S, typename M>
+    friend std::ostream& operator<<(std::ostream& stream, Counter<Type, S, M>& c);
 
   public:
     /**
@@ -41,7 +64,7 @@ class Counter
     /**
      * Map type: key - the element from a some sequence, value - the number of these elements
      */
-    using map_t = std::unordered_map<T, unsigned int>;
+    using map_t = Map;
 
   public:
     /**
@@ -51,6 +74,22 @@ class Counter
      */
     template<typename IteratorBegin, typename IteratorEnd>
     explicit Counter(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Constructor, counts the elements in several threads.
+     * Each thread counts a part of the sequence into its own map,
+     * after this the maps are merged. If the sequence is small,
+     * counts the elements in the current thread.
+     * @param _begin the random access iterator to the beginning of the sequence.
+     * @param _end the random access iterator to the end of the sequence.
+     * @param threads the number of threads, `0` - the number of hardware threads.
+     */
+    template<typename Iterator>
+    Counter(Iterator _begin, Iterator _end, unsigned int threads);
+    /**
+     * Constructor, takes the counted elements.
+     * @param elements the map: key - the element, value - the number of such elements.
+     */
+    explicit Counter(map_t elements);
     /**
      * Destructor.
      */
@@ -88,17 +127,57 @@ class Counter
     template<typename Array>
     void most_common(Array& list, int n = -1);
     /**
-     * Adds new element to this result and recounts result.
+     * Adds new element to this result.
+     * The elements are not sorted here, the order is rebuilt
+     * by the first call of the `most_common` or `begin` functions.
      * @param begin the iterator to the beginning of the sequence.
      * @param end the iterator to the end of the sequence.
      */
     template<typename IteratorBegin, typename IteratorEnd>
     void update(IteratorBegin begin, IteratorEnd end);
+    /**
+     * Adds the numbers of elements of another counter.
+     * The same as `collections.Counter.update` in Python.
+     * @param other another counter.
+     * @return this counter.
+     */
+    Counter& merge(const Counter& other);
+    /**
+     * Subtracts the numbers of elements of another counter.
+     * The numbers are unsigned, so the elements with the number `0` or less are removed.
+     * @param other another counter.
+     * @return this counter.
+     */
+    Counter& subtract(const Counter& other);
+    /**
+     * Returns the sum of the numbers of both counters.
+     * @param other another counter.
+     * @return a new counter.
+     */
+    Counter operator+(const Counter& other) const;
+    /**
+     * Returns the difference of the numbers, keeps only the positive numbers.
+     * @param other another counter.
+     * @return a new counter.
+     */
+    Counter operator-(const Counter& other) const;
+    /**
+     * Returns the intersection: the minimum of the numbers, keeps only the elements of both counters.
+     * @param other another counter.
+     * @return a new counter.
+     */
+    Counter operator&(const Counter& other) const;
+    /**
+     * Returns the union: the maximum of the numbers, keeps the elements of each counter.
+     * @param other another counter.
+     * @return a new counter.
+     */
+    Counter operator|(const Counter& other) const;
     /**
      * This function is static.
      * Takes two iterators on the sequence.
      * Counts the number of elements in the sequence.
-     * Return `std::unordered_map<T, int>`: T - the elements, int - the number of such elements.
+     * Return `map_t`: T - the elements, unsigned int - the number of such elements.
      * @code
      * For example: ('a', 'b', 'c', 'a', 'c', 'd', 'a', 'a', 'b', 'c')
      * -> {'a': 4, 'c': 3, 'b': 2, 'd': 1}.
@@ -109,6 +188,11 @@ class Counter
      */
     template<typename IteratorBegin, typename IteratorEnd>
     static map_t map(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * The minimum number of elements for one thread.
+     * If the sequence is smaller, the parallel constructor uses fewer threads.
+     */
+    static constexpr std::size_t parallel_threshold = 1 << 14;
     /**
      * @return size of the counted sequence.
      */
@@ -126,9 +210,22 @@ class Counter
     auto count(int& n) -> std::pair<vc_it, vc_it>;
     /**
      * The private `update` function.
-     * Updates the vector of the pairs and sorts this.
+     * Sorts the first `n` pairs of the vector, if they are not sorted yet.
+     * If the map was changed, copies the map to the vector before.
+     */
+    void update(std::size_t n);
+    /**
+     * Counts the elements of the random access sequence in several threads
+     * and adds the result to the map.
      */
-    void update();
+    template<typename Iterator>
+    static void count_parallel(Iterator _begin, Iterator _end, unsigned int threads, map_t& result);
+    /**
+     * Counts the elements of the sequence and adds the result to the map.
+     * Uses the `add` function of the map, if the map has it.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    static void count_into(map_t& result, IteratorBegin _begin, IteratorEnd _end);
     /**
      * Compares two pair
      */
@@ -137,8 +234,10 @@ class Counter
         return SortFirst && a.second == b.second ? a.first < b.first : a.second > b.second;
     }
 
-    map_t _elements;   //! map of elements.
-    vector_t _current; //! a sorted vector of elements.
+    map_t _elements;     //! map of elements.
+    vector_t _current;   //! a sorted vector of elements.
+    std::size_t _sorted; //! the number of the first pairs of the vector, which are sorted.
+    bool _dirty;         //! `true` if the map was changed after the last copying to the vector.
   public:
     /**
      * Implements the iterator for the `Counter` class.
@@ -146,7 +245,7 @@ class Counter
      */
     class iterator : public std::iterator<std::forward_iterator_tag, T>
     {
-        friend class Counter<T>;
+        friend class Counter<T, SortFirst, Map>;
 
       private:
 	/**
@@ -250,11 +349,19 @@ class Counter
     /**
      * @return the iterator to the first element of the `Counter` class.
      */
-    inline iterator begin() noexcept { return iterator(_current.cbegin(), _current.cend()); }
+    inline iterator begin()
+    {
+        update(_elements.size());
+        return iterator(_current.cbegin(), _current.cend());
+    }
     /**
      * @return the iterator to the end of the `Counter` class.
      */
-    inline iterator end() const noexcept { return iterator(_current.cend(), _current.cend()); }
+    inline iterator end()
+    {
+        update(_elements.size());
+        return iterator(_current.cend(), _current.cend());
+    }
 };
 
 /*
@@ -262,14 +369,88 @@ class Counter
  * @param _begin - the iterator to the beginning of the sequence.
  * @param _end - the iterator to the end of the sequence.
  */
-template<typename T, bool SortFirst>
+template<typename T, bool SortFirst, typename Map>
 template<typename IteratorBegin, typename IteratorEnd>
-Counter<T, SortFirst>::Counter(IteratorBegin _begin, IteratorEnd _end) : _elements(), _current()
+Counter<T, SortFirst, Map>::Counter(IteratorBegin _begin, IteratorEnd _end) :
+    _elements(), _current(), _sorted(0), _dirty(true)
+{
+    count_into(_elements, _begin, _end);
+}
+
+/*
+ * Constructor.
+ * Counts the elements in several threads.
+ */
+template<typename T, bool SortFirst, typename Map>
+template<typename Iterator>
+Counter<T, SortFirst, Map>::Counter(Iterator _begin, Iterator _end, unsigned int threads) :
+    _elements(), _current(), _sorted(0), _dirty(true)
 {
-    for(auto it = _begin; it != _end; it++) {
-        _elements[*it]++;
+    count_parallel(_begin, _end, threads, _elements);
+}
+
+/*
+ * Constructor.
+ * Takes the counted elements.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map>::Counter(map_t elements) : _elements(std::move(elements)), _current(), _sorted(0), _dirty(true)
+{}
+
+/*
+ * Counts the elements in several threads.
+ * The sequence is divided into equal parts, the last part is counted
+ * in the current thread. Then the maps of the threads are merged into the result.
+ */
+template<typename T, bool SortFirst, typename Map>
+template<typename Iterator>
+void Counter<T, SortFirst, Map>::count_parallel(Iterator _begin, Iterator _end, unsigned int threads, map_t& result)
+{
+    using category = typename std::iterator_traits<Iterator>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>, "Iterator must be a random access iterator.");
+    auto length = static_cast<std::size_t>(std::distance(_begin, _end));
+    if(!threads) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    // Serial fallback for small sequences.
+    threads = static_cast<unsigned int>(std::min<std::size_t>(threads, std::max<std::size_t>(length / parallel_threshold, 1)));
+
+    auto part = static_cast<std::ptrdiff_t>(length / threads);
+    std::vector<map_t> maps(threads - 1);
+    std::vector<std::exception_ptr> errors(threads - 1);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    // The started threads are joined in all cases: if a thread cannot be started or the current thread throws.
+    std::exception_ptr error = nullptr;
+    try {
+        for(unsigned int i = 0; i + 1 < threads; i++) {
+            workers.emplace_back([&, i]() {
+                try {
+                    auto first = _begin + part * static_cast<std::ptrdiff_t>(i);
+                    count_into(maps[i], first, first + part);
+                } catch(...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        count_into(result, _begin + part * static_cast<std::ptrdiff_t>(threads - 1), _end);
+    } catch(...) {
+        error = std::current_exception();
+    }
+    for(auto& worker : workers) {
+        worker.join();
+    }
+    if(error) {
+        std::rethrow_exception(error);
+    }
+    for(unsigned int i = 0; i + 1 < threads; i++) {
+        if(errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        for(const auto& p : maps[i]) {
+            result[p.first] += p.second;
+        }
     }
-    update();
 }
 
 /*
@@ -281,17 +462,31 @@ Counter<T, SortFirst>::Counter(IteratorBegin _begin, IteratorEnd _end) : _elemen
  * For example: ('a', 'b', 'c', 'a', 'c', 'd', 'a', 'a', 'b', 'c')
  * -> {'a': 4, 'c': 3, 'b': 2, 'd': 1}.
  */
-template<typename T, bool SortFirst>
+template<typename T, bool SortFirst, typename Map>
 template<typename IteratorBegin, typename IteratorEnd>
-typename Counter<T, SortFirst>::map_t Counter<T, SortFirst>::map(IteratorBegin _begin, IteratorEnd _end)
+typename Counter<T, SortFirst, Map>::map_t Counter<T, SortFirst, Map>::map(IteratorBegin _begin, IteratorEnd _end)
 {
     map_t result;
-    for(auto it = _begin; it != _end; it++) {
-        result[*it]++;
-    }
+    count_into(result, _begin, _end);
     return result;
 }
 
+/*
+ * Counts the elements of the sequence.
+ */
+template<typename T, bool SortFirst, typename Map>
+template<typename IteratorBegin, typename IteratorEnd>
+void Counter<T, SortFirst, Map>::count_into(map_t& result, IteratorBegin _begin, IteratorEnd _end)
+{
+    if constexpr(std::is_same_v<IteratorBegin, IteratorEnd> && _helpers_counter::has_add<map_t, IteratorBegin>::value) {
+        result.add(_begin, _end);
+    } else {
+        for(auto it = _begin; it != _end; it++) {
+            result[*it]++;
+        }
+    }
+}
+
 /*
  * The static `count` function.
  * Counts number of elements in the sequence and
@@ -307,14 +502,12 @@ typename Counter<T, SortFirst>::map_t Counter<T, SortFirst>::map(IteratorBegin _
  * std::set<Counter<std::string>::pair_t set = Counter<std::string>::count<std::set>(begin(...), end(...));
  * ```
  */
-template<typename T, bool SortFirst>
+template<typename T, bool SortFirst, typename Map>
 template<template<class...> class Array, typename IteratorBegin, typename IteratorEnd>
-constexpr Array<typename Counter<T, SortFirst>::pair_t> Counter<T, SortFirst>::count(IteratorBegin _begin, IteratorEnd _end)
+constexpr Array<typename Counter<T, SortFirst, Map>::pair_t> Counter<T, SortFirst, Map>::count(IteratorBegin _begin, IteratorEnd _end)
 {
     map_t map;
-    for(auto it = _begin; it != _end; it++) {
-        map[*it]++;
-    }
+    count_into(map, _begin, _end);
     vector_t vec(map.begin(), map.end());
     std::sort(vec.begin(), vec.end(), sort_pair);
 
@@ -327,28 +520,44 @@ constexpr Array<typename Counter<T, SortFirst>::pair_t> Counter<T, SortFirst>::c
 }
 
 /*
- * The private `update` function.
- * Updates the vector of pairs and sorts this.
+ * The private `count` function.
+ * Sorts only the first `n` pairs and returns the iterators to them.
  */
-template<typename T, bool SortFirst>
-auto Counter<T, SortFirst>::count(int& n) -> std::pair<Counter<T, SortFirst>::vc_it, Counter<T, SortFirst>::vc_it>
+template<typename T, bool SortFirst, typename Map>
+auto Counter<T, SortFirst, Map>::count(int& n) -> std::pair<Counter<T, SortFirst, Map>::vc_it, Counter<T, SortFirst, Map>::vc_it>
 {
-    vc_it end = _current.end();
+    std::size_t number = _elements.size();
     if(n != -1 && static_cast<unsigned int>(n) <= _elements.size()) {
-        end = _current.begin() + n;
+        number = static_cast<std::size_t>(n);
     }
-    return std::pair<vc_it, vc_it>(_current.begin(), end);
+    update(number);
+    return std::pair<vc_it, vc_it>(_current.begin(), _current.begin() + static_cast<std::ptrdiff_t>(number));
 }
 
 /*
  * Updates the `Counter` class.
+ * The pairs after the sorted part are not less than the sorted pairs,
+ * so only the rest of the vector is sorted: `[_sorted, n)`.
  */
-template<typename T, bool SortFirst>
-void Counter<T, SortFirst>::update()
+template<typename T, bool SortFirst, typename Map>
+void Counter<T, SortFirst, Map>::update(std::size_t n)
 {
-    _current.clear();
-    std::copy(_elements.begin(), _elements.end(), std::back_inserter(_current));
-    std::sort(_current.begin(), _current.end(), sort_pair);
+    if(_dirty) {
+        _current.assign(_elements.begin(), _elements.end());
+        _sorted = 0;
+        _dirty = false;
+    }
+    if(n <= _sorted) {
+        return;
+    }
+    auto first = _current.begin() + static_cast<std::ptrdiff_t>(_sorted);
+    if(n < _current.size()) {
+        std::partial_sort(first, _current.begin() + static_cast<std::ptrdiff_t>(n), _current.end(), sort_pair);
+    } else {
+        std::sort(first, _current.end(), sort_pair);
+        n = _current.size();
+    }
+    _sorted = n;
 }
 
 /*
@@ -362,8 +571,8 @@ void Counter<T, SortFirst>::update()
  * If you want to get some number of elements, you must pass a
  * number as the first argument.
  */
-template<typename T, bool SortFirst>
-typename Counter<T, SortFirst>::vector_t Counter<T, SortFirst>::most_common(int n)
+template<typename T, bool SortFirst, typename Map>
+typename Counter<T, SortFirst, Map>::vector_t Counter<T, SortFirst, Map>::most_common(int n)
 {
     auto iterators = count(n);
     return vector_t(iterators.first, iterators.second);
@@ -380,9 +589,9 @@ typename Counter<T, SortFirst>::vector_t Counter<T, SortFirst>::most_common(int
  * -> {'a', 'c', 'b', 'd'}.
  * Your array must have a type. For example: vector<T>.
  */
-template<typename T, bool SortFirst>
+template<typename T, bool SortFirst, typename Map>
 template<typename Array>
-void Counter<T, SortFirst>::most_common(Array& list, int n)
+void Counter<T, SortFirst, Map>::most_common(Array& list, int n)
 {
     auto iterators = count(n);
     std::transform(iterators.first, iterators.second, std::inserter(list, std::begin(list)), [](const pair_t& p) {
@@ -393,21 +602,130 @@ void Counter<T, SortFirst>::most_common(Array& list, int n)
 /*
  * Update the `Counter` class
  */
-template<typename T, bool SortFirst>
+template<typename T, bool SortFirst, typename Map>
 template<typename IteratorBegin, typename IteratorEnd>
-void Counter<T, SortFirst>::update(IteratorBegin _begin, IteratorEnd _end)
+void Counter<T, SortFirst, Map>::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    count_into(_elements, _begin, _end);
+    _dirty = true;
+}
+
+/*
+ * The `merge` function.
+ * Works on the maps, the order is rebuilt once, by the next call of `most_common` or `begin`.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map>& Counter<T, SortFirst, Map>::merge(const Counter& other)
+{
+    if(this == &other) {
+        // The numbers are doubled in place: the keys exist, so the map is not changed while it is iterated.
+        for(const auto& p : _elements) {
+            _elements[p.first] = 2 * p.second;
+        }
+        _dirty = true;
+        return *this;
+    }
+    for(const auto& p : other._elements) {
+        _elements[p.first] += p.second;
+    }
+    _dirty = true;
+    return *this;
+}
+
+/*
+ * The `subtract` function.
+ * The counter without itself is empty, the elements are not erased while the same map is iterated.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map>& Counter<T, SortFirst, Map>::subtract(const Counter& other)
+{
+    if(this == &other) {
+        _elements.clear();
+        _dirty = true;
+        return *this;
+    }
+    for(const auto& p : other._elements) {
+        if(!_elements.count(p.first)) {
+            continue;
+        }
+        unsigned int& number = _elements[p.first];
+        if(number > p.second) {
+            number -= p.second;
+        } else {
+            _elements.erase(p.first);
+        }
+    }
+    _dirty = true;
+    return *this;
+}
+
+/*
+ * The operator `+`.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map> Counter<T, SortFirst, Map>::operator+(const Counter& other) const
+{
+    Counter result(*this);
+    return result.merge(other);
+}
+
+/*
+ * The operator `-`.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map> Counter<T, SortFirst, Map>::operator-(const Counter& other) const
+{
+    Counter result(*this);
+    return result.subtract(other);
+}
+
+/*
+ * The operator `&`.
+ * The elements, which are not in another counter, are removed after the loop.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map> Counter<T, SortFirst, Map>::operator&(const Counter& other) const
+{
+    Counter result(*this);
+    std::vector<T> removed;
+    for(const auto& p : result._elements) {
+        if(!other._elements.count(p.first)) {
+            removed.push_back(p.first);
+        }
+    }
+    for(const auto& e : removed) {
+        result._elements.erase(e);
+    }
+    for(const auto& p : other._elements) {
+        if(result._elements.count(p.first)) {
+            unsigned int& number = result._elements[p.first];
+            number = std::min(number, p.second);
+        }
+    }
+    result._dirty = true;
+    return result;
+}
+
+/*
+ * The operator `|`.
+ */
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map> Counter<T, SortFirst, Map>::operator|(const Counter& other) const
 {
-    for(auto it = _begin; it != _end; it++) {
-        _elements[*it]++;
+    Counter result(*this);
+    for(const auto& p : other._elements) {
+        unsigned int& number = result._elements[p.first];
+        number = std::max(number, p.second);
     }
-    update();
+    result._dirty = true;
+    return result;
 }
 
 /*
  * Constructor.
  */
-template<typename T, bool SortFirst>
-Counter<T, SortFirst>::iterator::iterator(vc_it it, vc_it end) : _begin(it), _end(end)
+template<typename T, bool SortFirst, typename Map>
+Counter<T, SortFirst, Map>::iterator::iterator(vc_it it, vc_it end) : _begin(it), _end(end)
 {}
 
 /**
@@ -417,20 +735,99 @@ Counter<T, SortFirst>::iterator::iterator(vc_it it, vc_it end) : _begin(it), _en
  * @param c the `Counter` class.
  * @return std::ostream.
  */
-template<typename Type, bool SortFirst>
-std::ostream& operator<<(std::ostream& stream, Counter<Type, SortFirst>& c)
+template<typename Type, bool SortFirst, typename Map>
+std::ostream& operator<<(std::ostream& stream, Counter<Type, SortFirst, Map>& c)
 {
     stream << "{";
     std::size_t i = 0;
     for(auto it = c.begin(); it != c.end(); ++it) {
         stream << "(" << it->first << ": " << it->second << ")";
-        stream << (i + 1 < c._current.size() ? ", " : "");
+        stream << (i + 1 < c.size() ? ", " : "");
         ++i;
     }
     stream << "}";
     return stream;
 }
 
+/**
+ * The `Counter` class, which counts elements using the `FlatMap` class.
+ * Use this for the increment-heavy workloads.
+ */
+template<typename T, bool SortFirst = true>
+using FlatCounter = Counter<T, SortFirst, FlatMap<T, unsigned int>>;
+
+/**
+ * The `Counter` class, which counts elements using the `DenseMap` class.
+ * Use this for the small integral types: `char`, `uint8_t`, `uint16_t` ...
+ */
+template<typename T, bool SortFirst = true>
+using DenseCounter = Counter<T, SortFirst, DenseMap<T, unsigned int>>;
+
 #endif
 
+#include <stddef.h>
+
+/*
+ * A declaration the structure `c_counter` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The structure `c_counter`.
+     * Counts the elements of the same size, it is implemented by the `Counter` class with the hash map.
+     * The elements are copied into the map, hashed and compared by the functions of the user.
+     */
+    typedef struct c_counter c_counter;
+    /**
+     * Creates a new counter.
+     * @param element_size the size of each element, from `1` to `256` bytes.
+     * @param hash the hash function. If it is `NULL`, the bytes are hashed.
+     * @param compare the comparison function: negative if the first element is less, `0` if the elements are equal,
+     * otherwise positive. It orders the elements with the same number. If it is `NULL`, the bytes are compared by `memcmp`.
+     * @return a new counter, `NULL` if the size is wrong.
+     */
+    c_counter* c_counter_create(size_t element_size, size_t (*hash)(const void*), int (*compare)(const void*, const void*));
+    /**
+     * Counts the element.
+     * @param c a pointer to the counter.
+     * @param element a pointer to the element.
+     */
+    void c_counter_add(c_counter* c, const void* element);
+    /**
+     * Counts the array of the elements.
+     * @param c a pointer to the counter.
+     * @param elements a pointer to the contiguous array of the elements.
+     * @param n the number of the elements.
+     */
+    void c_counter_add_n(c_counter* c, const void* elements, size_t n);
+    /**
+     * Copies the most common elements and their numbers, the elements are sorted by the greater number.
+     * @param c a pointer to the counter.
+     * @param n the maximum number of the elements.
+     * @param elements a pointer to the memory for `n` elements.
+     * @param counts a pointer to the memory for `n` numbers, can be `NULL`.
+     * @return the number of the copied elements.
+     */
+    size_t c_counter_most_common(c_counter* c, size_t n, void* elements, unsigned int* counts);
+    /**
+     * Returns the number of the different elements.
+     * @param c a pointer to the counter.
+     * @return the number of the different elements.
+     */
+    size_t c_counter_size(const c_counter* c);
+    /**
+     * Removes the counter from memory.
+     * @param c a pointer to the counter.
+     */
+    void c_counter_delete(c_counter* c);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* COUNTER_H */
@@ -0,0 +1,352 @@
+/**
+ * @file dense_map.h
+ *
+ * Contains the class `DenseMap`.
+ */
+#ifndef DENSE_MAP_H
+#define DENSE_MAP_H
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace _helpers_dense_map
+{
+/**
+ * The vector instructions for the addition of the values.
+ * `enabled` is `false`, if the instructions are not supported or the values are not 32-bit integers,
+ * then the portable code is used.
+ * This is helper struct. Do not use this.
+ */
+template<typename Value, typename = void>
+struct Simd
+{
+    static constexpr bool enabled = false;
+};
+#if defined(__AVX2__)
+template<typename Value>
+struct Simd<Value, std::enable_if_t<std::is_integral_v<Value> && sizeof(Value) == 4>>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 8;
+    using reg = __m256i;
+    static inline reg load(const Value* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+    static inline void store(Value* p, reg a) noexcept { _mm256_storeu_si256(reinterpret_cast<reg*>(p), a); }
+    static inline reg add(reg a, reg b) noexcept { return _mm256_add_epi32(a, b); }
+};
+#elif defined(__SSE2__)
+template<typename Value>
+struct Simd<Value, std::enable_if_t<std::is_integral_v<Value> && sizeof(Value) == 4>>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    using reg = __m128i;
+    static inline reg load(const Value* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const reg*>(p)); }
+    static inline void store(Value* p, reg a) noexcept { _mm_storeu_si128(reinterpret_cast<reg*>(p), a); }
+    static inline reg add(reg a, reg b) noexcept { return _mm_add_epi32(a, b); }
+};
+#endif
+} // namespace _helpers_dense_map
+
+/**
+ * The `DenseMap` class.
+ * This class is a map for the small integral keys (`char`, `uint8_t`, `int16_t`, `uint16_t` ...).
+ * The values are stored in an array with a slot for each possible key,
+ * so a key is the index of its value, without hashing.
+ * The interface is a part of the `std::unordered_map` interface, but a key exists only
+ * if its value is not `Value()`: the operator `[]` does not insert the key.
+ * The `add` function counts a sequence of keys using several interleaved arrays.
+ * @tparam Key type of keys, an integral type with size 1 or 2 bytes.
+ * @tparam Value type of values.
+ */
+template<typename Key, typename Value = unsigned int>
+class DenseMap
+{
+    static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool> && sizeof(Key) <= 2,
+                  "Key must be an integral type with size 1 or 2 bytes.");
+
+  public:
+    using key_type = Key;                     //! type of keys.
+    using mapped_type = Value;                //! type of values.
+    using value_type = std::pair<Key, Value>; //! type of pairs.
+    using size_type = std::size_t;            //! type of sizes.
+
+    /**
+     * The number of slots: the number of possible keys.
+     */
+    static constexpr size_type range = size_type(1) << (8 * sizeof(Key));
+
+    /**
+     * Implements the const iterator of the map.
+     * The iterator is `input_iterator`, the pairs are created by the iterator.
+     */
+    class const_iterator
+    {
+        friend class DenseMap<Key, Value>;
+
+      private:
+        /**
+         * Constructor.
+         * Skips the empty slots.
+         */
+        const_iterator(const Value* slot, const Value* begin, const Value* end) noexcept :
+            _slot(slot), _begin(begin), _end(end)
+        {
+            skip();
+        }
+
+      public:
+        using value_type = std::pair<Key, Value>;          //! iterator value type.
+        using difference_type = std::ptrdiff_t;            //! iterator difference type.
+        using pointer = const value_type*;                 //! iterator pointer type.
+        using reference = const value_type&;               //! iterator reference type.
+        using iterator_category = std::input_iterator_tag; //! iterator category
+        /**
+         * Default constructor.
+         */
+        const_iterator() = default;
+        /**
+         * The prefix operator `++`.
+         * Increases the pointer and returns it.
+         * @return incremented iterator.
+         */
+        inline const_iterator& operator++() noexcept
+        {
+            ++_slot;
+            skip();
+            return *this;
+        }
+        /**
+         * The postfix operator `++`.
+         * Increases the pointer and returns the previous iterator.
+         * @return the previous iterator.
+         */
+        inline const_iterator operator++([[maybe_unused]] int j) noexcept
+        {
+            const_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+        /**
+         * @return the pair.
+         */
+        inline const value_type& operator*() const noexcept { return _pair; }
+        /**
+         * @return a pointer to the pair.
+         */
+        inline const value_type* operator->() const noexcept { return &_pair; }
+        /**
+         * Compares two iterators.
+         * @param rhs another iterator.
+         * @return result of comparison.
+         */
+        inline bool operator==(const const_iterator& rhs) const noexcept { return _slot == rhs._slot; }
+        /**
+         * Compares two iterators.
+         * @param rhs another iterator.
+         * @return result of comparison.
+         */
+        inline bool operator!=(const const_iterator& rhs) const noexcept { return _slot != rhs._slot; }
+
+      private:
+        /**
+         * Skips the empty slots and makes the current pair.
+         */
+        inline void skip() noexcept
+        {
+            while(_slot != _end && *_slot == Value()) {
+                ++_slot;
+            }
+            if(_slot != _end) {
+                _pair = value_type(key_of(static_cast<size_type>(_slot - _begin)), *_slot);
+            }
+        }
+
+        const Value* _slot{nullptr};  //! a pointer to the slot.
+        const Value* _begin{nullptr}; //! a pointer to the first slot.
+        const Value* _end{nullptr};   //! a pointer to the end of slots.
+        value_type _pair{};           //! the current pair.
+    };
+
+  public:
+    /**
+     * Default constructor.
+     * Allocates the slots for all the keys.
+     */
+    DenseMap() : _values(range, Value()) {}
+    /**
+     * Returns the value by the key.
+     * @param key a key.
+     * @return the value.
+     */
+    inline Value& operator[](Key key)
+    {
+        _size_dirty = true;
+        return _values[index(key)];
+    }
+    /**
+     * @param key a key.
+     * @return `1` if the key exists, otherwise `0`.
+     */
+    inline size_type count(Key key) const noexcept { return _values[index(key)] != Value() ? 1 : 0; }
+    /**
+     * Removes the pair by the key.
+     * @param key a key.
+     * @return the number of removed pairs.
+     */
+    size_type erase(Key key) noexcept;
+    /**
+     * Counts the keys of the sequence: increments the value of each key.
+     * A large random access sequence is counted into several interleaved arrays,
+     * so the increments of the repeated keys do not wait for each other,
+     * after this the arrays are added to the values.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename Iterator>
+    void add(Iterator _begin, Iterator _end);
+    /**
+     * Removes all the pairs.
+     */
+    void clear() noexcept;
+    /**
+     * @return the number of keys. Counts the keys, if the values were changed.
+     */
+    size_type size() const noexcept;
+    /**
+     * @return `true` if the map is empty, otherwise `false`.
+     */
+    inline bool empty() const noexcept { return size() == 0; }
+    /**
+     * @return the const iterator to the first pair.
+     */
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator(_values.data(), _values.data(), _values.data() + _values.size());
+    }
+    /**
+     * @return the const iterator to the end of the map.
+     */
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator(_values.data() + _values.size(), _values.data(), _values.data() + _values.size());
+    }
+
+  private:
+    /**
+     * The number of interleaved arrays of the `add` function.
+     */
+    static constexpr std::ptrdiff_t lanes = 4;
+    /**
+     * Returns the index of the slot of the key.
+     */
+    static inline size_type index(Key key) noexcept
+    {
+        return static_cast<size_type>(static_cast<std::make_unsigned_t<Key>>(key));
+    }
+    /**
+     * Returns the key of the slot.
+     */
+    static inline Key key_of(size_type i) noexcept { return static_cast<Key>(static_cast<std::make_unsigned_t<Key>>(i)); }
+
+  private:
+    std::vector<Value> _values;      //! the values, one slot for each key.
+    mutable size_type _size{0};      //! the number of keys.
+    mutable bool _size_dirty{false}; //! `true` if the values were changed after the last counting of keys.
+};
+
+/*
+ * The `erase` function.
+ */
+template<typename Key, typename Value>
+typename DenseMap<Key, Value>::size_type DenseMap<Key, Value>::erase(Key key) noexcept
+{
+    Value& value = _values[index(key)];
+    if(value == Value()) {
+        return 0;
+    }
+    value = Value();
+    _size_dirty = true;
+    return 1;
+}
+
+/*
+ * The `add` function.
+ * The small sequences are counted directly into the values:
+ * the interleaved arrays are not worth clearing and adding.
+ */
+template<typename Key, typename Value>
+template<typename Iterator>
+void DenseMap<Key, Value>::add(Iterator _begin, Iterator _end)
+{
+    using category = typename std::iterator_traits<Iterator>::iterator_category;
+    _size_dirty = true;
+    if constexpr(std::is_base_of_v<std::random_access_iterator_tag, category>) {
+        if(_end - _begin >= lanes * static_cast<std::ptrdiff_t>(range)) {
+            std::vector<Value> lane(static_cast<size_type>(lanes) * range, Value());
+            Value* h = lane.data();
+            auto it = _begin;
+            for(; _end - it >= lanes; it += lanes) {
+                h[index(static_cast<Key>(it[0]))]++;
+                h[range + index(static_cast<Key>(it[1]))]++;
+                h[2 * range + index(static_cast<Key>(it[2]))]++;
+                h[3 * range + index(static_cast<Key>(it[3]))]++;
+            }
+            for(; it != _end; ++it) {
+                _values[index(static_cast<Key>(*it))]++;
+            }
+            // The arrays are added by the vector instructions, if they are supported, the rest - by the scalar loop.
+            Value* values = _values.data();
+            size_type i = 0;
+            if constexpr(_helpers_dense_map::Simd<Value>::enabled) {
+                using simd = _helpers_dense_map::Simd<Value>;
+                for(; i + simd::lanes <= range; i += simd::lanes) {
+                    auto first = simd::add(simd::load(h + i), simd::load(h + range + i));
+                    auto second = simd::add(simd::load(h + 2 * range + i), simd::load(h + 3 * range + i));
+                    simd::store(values + i, simd::add(simd::load(values + i), simd::add(first, second)));
+                }
+            }
+            for(; i < range; i++) {
+                values[i] += h[i] + h[range + i] + h[2 * range + i] + h[3 * range + i];
+            }
+            return;
+        }
+    }
+    for(auto it = _begin; it != _end; ++it) {
+        _values[index(static_cast<Key>(*it))]++;
+    }
+}
+
+/*
+ * The `clear` function.
+ */
+template<typename Key, typename Value>
+void DenseMap<Key, Value>::clear() noexcept
+{
+    std::fill(_values.begin(), _values.end(), Value());
+    _size = 0;
+    _size_dirty = false;
+}
+
+/*
+ * The `size` function.
+ */
+template<typename Key, typename Value>
+typename DenseMap<Key, Value>::size_type DenseMap<Key, Value>::size() const noexcept
+{
+    if(_size_dirty) {
+        _size = static_cast<size_type>(std::count_if(_values.begin(), _values.end(), [](const Value& v) { return v != Value(); }));
+        _size_dirty = false;
+    }
+    return _size;
+}
+
+#endif /* __cplusplus */
+
+#endif /* DENSE_MAP_H */
@@ -8,6 +8,8 @@
 
 #include <utility>
 #include <memory>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
 
 namespace _helpers_extensions
@@ -98,6 +100,17 @@ extern "C"
         std::memcpy(p, pointer, length);
         return p;
     }
+    /**
+     * Returns the offset of the value, which is stored in the same memory block after the node.
+     * The offset keeps the alignment of `malloc` for the value.
+     * @param node_size the size of the node structure.
+     * @return the offset of the value from the beginning of the node.
+     */
+    static inline size_t inline_value_offset(size_t node_size)
+    {
+        const size_t alignment = alignof(std::max_align_t);
+        return (node_size + alignment - 1) / alignment * alignment;
+    }
     } // namespace pure_c
 
 #ifdef __cplusplus
@@ -0,0 +1,4 @@
+/*
+ * This file required to create the `.so` library.
+ */
+#include "flat_map.h"
@@ -0,0 +1,588 @@
+/**
+ * @file flat_map.h
+ *
+ * Contains the class `FlatMap`.
+ */
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * The `FlatMap` class.
+ * This class is a hash map with open addressing (Robin Hood hashing).
+ * All the pairs are stored in one array, without a node for each key,
+ * so the increment of a value costs one probe in the array in most cases.
+ * Removing uses the backward shift, without tombstones.
+ * The interface is a part of the `std::unordered_map` interface.
+ * The key must be default constructible and copyable. The hash function
+ * must not return the same value for a lot of keys, the chain of such keys
+ * is limited by 254 slots.
+ * @tparam Key type of keys.
+ * @tparam Value type of values.
+ * @tparam Hash hash function.
+ * @tparam KeyEqual function to compare keys.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatMap
+{
+  public:
+    using key_type = Key;                       //! type of keys.
+    using mapped_type = Value;                  //! type of values.
+    using value_type = std::pair<Key, Value>;   //! type of pairs.
+    using size_type = std::size_t;              //! type of sizes.
+    using hasher = Hash;                        //! hash function.
+    using key_equal = KeyEqual;                 //! function to compare keys.
+
+  private:
+    /**
+     * Implements the iterator of the map.
+     * The iterator is `forward_iterator`.
+     * @tparam V `value_type` or `const value_type`.
+     */
+    template<typename V>
+    class basic_iterator
+    {
+        /**
+         * Makes the `FlatMap` class and another iterators friends.
+         */
+        friend class FlatMap<Key, Value, Hash, KeyEqual>;
+        template<typename U>
+        friend class basic_iterator;
+
+      private:
+        /**
+         * Constructor.
+         * Skips the empty slots.
+         */
+        basic_iterator(V* slot, const std::uint8_t* dist, const std::uint8_t* end) noexcept :
+            _slot(slot), _dist(dist), _end(end)
+        {
+            skip();
+        }
+
+      public:
+        using value_type = std::remove_const_t<V>;           //! iterator value type.
+        using difference_type = std::ptrdiff_t;              //! iterator difference type.
+        using pointer = V*;                                  //! iterator pointer type.
+        using reference = V&;                                //! iterator reference type.
+        using iterator_category = std::forward_iterator_tag; //! iterator category
+        /**
+         * Default constructor.
+         */
+        basic_iterator() = default;
+        /**
+         * Constructor, converts the iterator to the const iterator.
+         * @param it the iterator.
+         */
+        template<typename U, std::enable_if_t<std::is_same_v<const U, V> && !std::is_same_v<U, V>>* = nullptr>
+        basic_iterator(const basic_iterator<U>& it) noexcept : _slot(it._slot), _dist(it._dist), _end(it._end)
+        {}
+        /**
+         * The prefix operator `++`.
+         * Increases the pointer and returns it.
+         * @return incremented iterator.
+         */
+        inline basic_iterator& operator++() noexcept
+        {
+            ++_slot, ++_dist;
+            skip();
+            return *this;
+        }
+        /**
+         * The postfix operator `++`.
+         * Increases the pointer and returns the previous iterator.
+         * @return the previous iterator.
+         */
+        inline basic_iterator operator++([[maybe_unused]] int j) noexcept
+        {
+            basic_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+        /**
+         * @return the pair.
+         */
+        inline V& operator*() const noexcept { return *_slot; }
+        /**
+         * @return a pointer to the pair.
+         */
+        inline V* operator->() const noexcept { return _slot; }
+        /**
+         * Compares two iterators.
+         * @param rhs another iterator.
+         * @return result of comparison.
+         */
+        inline bool operator==(const basic_iterator& rhs) const noexcept { return _slot == rhs._slot; }
+        /**
+         * Compares two iterators.
+         * @param rhs another iterator.
+         * @return result of comparison.
+         */
+        inline bool operator!=(const basic_iterator& rhs) const noexcept { return _slot != rhs._slot; }
+
+      private:
+        /**
+         * Skips the empty slots.
+         */
+        inline void skip() noexcept
+        {
+            while(_dist != _end && !*_dist) {
+                ++_slot, ++_dist;
+            }
+        }
+
+        V* _slot{nullptr};                 //! a pointer to the slot.
+        const std::uint8_t* _dist{nullptr}; //! a pointer to the distance of the slot.
+        const std::uint8_t* _end{nullptr};  //! a pointer to the end of distances.
+    };
+
+  public:
+    using iterator = basic_iterator<value_type>;             //! iterator.
+    using const_iterator = basic_iterator<const value_type>; //! const iterator.
+
+  public:
+    /**
+     * Default constructor.
+     * Does not allocate memory.
+     */
+    FlatMap() = default;
+    /**
+     * Constructor.
+     * Reserves memory for the number of keys.
+     * @param n the number of keys.
+     */
+    explicit FlatMap(size_type n);
+    /**
+     * Copy constructor and copy assignment.
+     */
+    FlatMap(const FlatMap&) = default;
+    FlatMap& operator=(const FlatMap&) = default;
+    /**
+     * Move constructor.
+     * The moved map is left empty, without memory.
+     * @param other a moved map.
+     */
+    FlatMap(FlatMap&& other) noexcept;
+    /**
+     * Move assignment.
+     * The moved map is left empty, without memory.
+     * @param other a moved map.
+     * @return this map.
+     */
+    FlatMap& operator=(FlatMap&& other) noexcept;
+    /**
+     * Returns the value by the key.
+     * If the key does not exist, inserts the key with the value `Value()`.
+     * @param key a key.
+     * @return the value.
+     */
+    template<typename K>
+    Value& operator[](K&& key);
+    /**
+     * Returns the iterator to the pair by the key.
+     * If the key does not exist, returns `end()`.
+     * @param key a key, or any value which can be hashed by `Hash` and compared by `KeyEqual`.
+     * @return the iterator.
+     */
+    template<typename K>
+    iterator find(const K& key);
+    /**
+     * The const version of the `find` function.
+     * @param key a key.
+     * @return the const iterator.
+     */
+    template<typename K>
+    const_iterator find(const K& key) const;
+    /**
+     * @param key a key.
+     * @return `1` if the key exists, otherwise `0`.
+     */
+    template<typename K>
+    inline size_type count(const K& key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+    /**
+     * Removes the pair by the key.
+     * @param key a key.
+     * @return the number of removed pairs.
+     */
+    template<typename K>
+    size_type erase(const K& key);
+    /**
+     * Reserves memory for the number of keys.
+     * @param n the number of keys.
+     */
+    void reserve(size_type n);
+    /**
+     * Removes all the pairs, but keeps memory.
+     */
+    void clear() noexcept;
+    /**
+     * @return the number of keys.
+     */
+    inline size_type size() const noexcept { return _size; }
+    /**
+     * @return `true` if the map is empty, otherwise `false`.
+     */
+    inline bool empty() const noexcept { return _size == 0; }
+    /**
+     * @return the number of slots.
+     */
+    inline size_type capacity() const noexcept { return _slots.size(); }
+    /**
+     * @return the iterator to the first pair.
+     */
+    inline iterator begin() noexcept { return iterator(_slots.data(), _dist.data(), _dist.data() + _dist.size()); }
+    /**
+     * @return the iterator to the end of the map.
+     */
+    inline iterator end() noexcept
+    {
+        return iterator(_slots.data() + _slots.size(), _dist.data() + _dist.size(), _dist.data() + _dist.size());
+    }
+    /**
+     * @return the const iterator to the first pair.
+     */
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator(_slots.data(), _dist.data(), _dist.data() + _dist.size());
+    }
+    /**
+     * @return the const iterator to the end of the map.
+     */
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator(_slots.data() + _slots.size(), _dist.data() + _dist.size(), _dist.data() + _dist.size());
+    }
+
+  private:
+    /**
+     * The maximum distance from the home slot.
+     * The distance is stored as `distance + 1`, `0` - the empty slot.
+     */
+    static constexpr std::uint8_t max_dist = 255;
+    /**
+     * Returns the home slot of the key.
+     * Uses Fibonacci hashing, so the weak hash functions
+     * (for example, `std::hash<int>`) are spread over the table.
+     * The table without slots has `_shift == 64` and `_mask == 0`, so the result is `0` without the shift by 64.
+     */
+    template<typename K>
+    inline size_type home(const K& key) const
+    {
+        auto h = static_cast<std::uint64_t>(Hash{}(key));
+        return static_cast<size_type>((h * 0x9E3779B97F4A7C15ull) >> (_shift & 63)) & _mask;
+    }
+    /**
+     * Leaves the map empty, without memory.
+     */
+    void reset() noexcept;
+    /**
+     * Returns the index of the slot with the key, or `capacity()` if the key does not exist.
+     */
+    template<typename K>
+    size_type find_index(const K& key) const;
+    /**
+     * Inserts a new pair from the slot `i` with the distance `d`.
+     * Returns the index of the inserted pair.
+     */
+    size_type place(size_type i, std::uint8_t d, value_type&& pair);
+    /**
+     * Inserts a new pair, the key of which does not exist in the map.
+     * Returns the index of the inserted pair.
+     */
+    size_type insert_new(value_type&& pair);
+    /**
+     * Changes the number of slots and moves all the pairs.
+     */
+    void rehash(size_type n);
+
+  private:
+    std::vector<value_type> _slots{};   //! the pairs.
+    std::vector<std::uint8_t> _dist{};  //! the distances from the home slots, `0` - the empty slot.
+    size_type _size{0};                 //! the number of keys.
+    size_type _mask{0};                 //! the number of slots - 1.
+    size_type _max_size{0};             //! the maximum number of keys before the rehashing.
+    unsigned int _shift{64};            //! the shift for the Fibonacci hashing.
+};
+
+/*
+ * Constructor.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatMap<Key, Value, Hash, KeyEqual>::FlatMap(size_type n)
+{
+    reserve(n);
+}
+
+/*
+ * Move constructor.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatMap<Key, Value, Hash, KeyEqual>::FlatMap(FlatMap&& other) noexcept :
+    _slots(std::move(other._slots)),
+    _dist(std::move(other._dist)),
+    _size(other._size),
+    _mask(other._mask),
+    _max_size(other._max_size),
+    _shift(other._shift)
+{
+    other.reset();
+}
+
+/*
+ * Move assignment.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatMap<Key, Value, Hash, KeyEqual>& FlatMap<Key, Value, Hash, KeyEqual>::operator=(FlatMap&& other) noexcept
+{
+    if(this != &other) {
+        _slots = std::move(other._slots);
+        _dist = std::move(other._dist);
+        _size = other._size;
+        _mask = other._mask;
+        _max_size = other._max_size;
+        _shift = other._shift;
+        other.reset();
+    }
+    return *this;
+}
+
+/*
+ * The operator `[]`.
+ * Finds the key, if the key does not exist, inserts it
+ * in the first slot, which is closer to its home slot than the current pair.
+ * The table is rehashed only for the insertion: the existing key does not move the pairs,
+ * so the map can be changed while another map (or itself) is iterated.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K>
+Value& FlatMap<Key, Value, Hash, KeyEqual>::operator[](K&& key)
+{
+    size_type i = 0;
+    std::uint8_t d = 1;
+    if(!_slots.empty()) {
+        i = home(key);
+        while(_dist[i] >= d) {
+            if(_dist[i] == d && KeyEqual{}(_slots[i].first, key)) {
+                return _slots[i].second;
+            }
+            i = (i + 1) & _mask;
+            ++d;
+        }
+    }
+    if(_size + 1 > _max_size || d == max_dist) {
+        // The table is full or the chain is too long.
+        rehash(_slots.empty() ? 16 : _slots.size() * 2);
+        return _slots[insert_new(value_type(Key(std::forward<K>(key)), Value()))].second;
+    }
+    return _slots[place(i, d, value_type(Key(std::forward<K>(key)), Value()))].second;
+}
+
+/*
+ * The `find` function.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K>
+typename FlatMap<Key, Value, Hash, KeyEqual>::iterator FlatMap<Key, Value, Hash, KeyEqual>::find(const K& key)
+{
+    size_type i = find_index(key);
+    return iterator(_slots.data() + i, _dist.data() + i, _dist.data() + _dist.size());
+}
+
+/*
+ * The const `find` function.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K>
+typename FlatMap<Key, Value, Hash, KeyEqual>::const_iterator FlatMap<Key, Value, Hash, KeyEqual>::find(const K& key) const
+{
+    size_type i = find_index(key);
+    return const_iterator(_slots.data() + i, _dist.data() + i, _dist.data() + _dist.size());
+}
+
+/*
+ * The `erase` function.
+ * Moves the next pairs back, while they are not in their home slots.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K>
+typename FlatMap<Key, Value, Hash, KeyEqual>::size_type FlatMap<Key, Value, Hash, KeyEqual>::erase(const K& key)
+{
+    size_type i = find_index(key);
+    if(i == _slots.size()) {
+        return 0;
+    }
+    size_type next = (i + 1) & _mask;
+    while(_dist[next] > 1) {
+        _slots[i] = std::move(_slots[next]);
+        _dist[i] = static_cast<std::uint8_t>(_dist[next] - 1);
+        i = next;
+        next = (next + 1) & _mask;
+    }
+    _slots[i] = value_type();
+    _dist[i] = 0;
+    --_size;
+    return 1;
+}
+
+/*
+ * Reserves memory for the number of keys.
+ * The number of slots is a power of two.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatMap<Key, Value, Hash, KeyEqual>::reserve(size_type n)
+{
+    size_type slots = 16;
+    while(slots - slots / 8 < n) {
+        slots *= 2;
+    }
+    if(slots > _slots.size()) {
+        rehash(slots);
+    }
+}
+
+/*
+ * Removes all the pairs.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatMap<Key, Value, Hash, KeyEqual>::clear() noexcept
+{
+    for(size_type i = 0; i < _slots.size(); i++) {
+        if(_dist[i]) {
+            _slots[i] = value_type();
+            _dist[i] = 0;
+        }
+    }
+    _size = 0;
+}
+
+/*
+ * Leaves the map empty, without memory.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatMap<Key, Value, Hash, KeyEqual>::reset() noexcept
+{
+    _slots.clear();
+    _slots.shrink_to_fit();
+    _dist.clear();
+    _dist.shrink_to_fit();
+    _size = 0;
+    _mask = 0;
+    _max_size = 0;
+    _shift = 64;
+}
+
+/*
+ * Returns the index of the slot with the key.
+ * The search stops on the slot, which is closer to its home slot
+ * than the key could be (Robin Hood invariant).
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+template<typename K>
+typename FlatMap<Key, Value, Hash, KeyEqual>::size_type FlatMap<Key, Value, Hash, KeyEqual>::find_index(const K& key) const
+{
+    if(!_size || _slots.empty()) {
+        return _slots.size();
+    }
+    size_type i = home(key);
+    std::uint8_t d = 1;
+    while(_dist[i] >= d) {
+        if(_dist[i] == d && KeyEqual{}(_slots[i].first, key)) {
+            return i;
+        }
+        i = (i + 1) & _mask;
+        ++d;
+    }
+    return _slots.size();
+}
+
+/*
+ * Inserts a new pair.
+ * If the current pair is closer to its home slot, than the inserted pair,
+ * swaps them and continues with the current pair.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatMap<Key, Value, Hash, KeyEqual>::size_type FlatMap<Key, Value, Hash, KeyEqual>::place(size_type i,
+                                                                                                 std::uint8_t d,
+                                                                                                 value_type&& pair)
+{
+    // The slot `i` is empty or closer to its home slot, so the inserted pair stays in this slot.
+    const size_type first = i;
+    ++_size;
+    while(_dist[i]) {
+        if(_dist[i] < d) {
+            std::swap(pair, _slots[i]);
+            std::swap(d, _dist[i]);
+        }
+        i = (i + 1) & _mask;
+        if(++d == max_dist) {
+            // Too long chain, the table is too small.
+            Key key = _slots[first].first;
+            --_size;
+            rehash(_slots.size() * 2);
+            insert_new(std::move(pair));
+            return find_index(key);
+        }
+    }
+    _slots[i] = std::move(pair);
+    _dist[i] = d;
+    return first;
+}
+
+/*
+ * Inserts a new pair, the key of which does not exist in the map.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatMap<Key, Value, Hash, KeyEqual>::size_type FlatMap<Key, Value, Hash, KeyEqual>::insert_new(value_type&& pair)
+{
+    while(true) {
+        size_type i = home(pair.first);
+        std::uint8_t d = 1;
+        while(_dist[i] >= d) {
+            i = (i + 1) & _mask;
+            ++d;
+        }
+        if(d < max_dist) {
+            return place(i, d, std::move(pair));
+        }
+        rehash(_slots.size() * 2);
+    }
+}
+
+/*
+ * Changes the number of slots and moves all the pairs.
+ */
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatMap<Key, Value, Hash, KeyEqual>::rehash(size_type n)
+{
+    std::vector<value_type> slots(n);
+    std::vector<std::uint8_t> dist(n, 0);
+    slots.swap(_slots);
+    dist.swap(_dist);
+
+    _mask = n - 1;
+    _max_size = n - n / 8;
+    _shift = 64;
+    for(size_type s = n; s > 1; s >>= 1) {
+        --_shift;
+    }
+    _size = 0;
+    for(size_type i = 0; i < slots.size(); i++) {
+        if(dist[i]) {
+            insert_new(std::move(slots[i]));
+        }
+    }
+}
+
+#endif /* __cplusplus */
+
+#endif /* FLAT_MAP_H */
@@ -0,0 +1,168 @@
+#include "pool.h"
+#include "extensions.h"
+#include <cstdint>
+
+namespace pure_c
+{
+/*
+ * The slab header, the blocks follow it.
+ * The slab is aligned to its size, so the slab of a block is found by the mask.
+ */
+struct pool_slab
+{
+    pool_slab* next; //! the next slab.
+    size_t used;     //! the number of used blocks.
+};
+
+/*
+ * The size of the slab.
+ */
+static const size_t pool_slab_size = 1 << 16;
+
+/*
+ * The size of the smallest block.
+ */
+static const size_t pool_min_block = 32;
+
+/*
+ * Returns the size class of the block, `POOL_CLASSES` if the block is too large for the pool.
+ */
+static inline size_t pool_class(size_t size)
+{
+    size_t c = 0;
+    size_t block = pool_min_block;
+    while(block < size && c < POOL_CLASSES) {
+        block <<= 1;
+        c++;
+    }
+    return c;
+}
+
+/*
+ * Returns the slab of the block.
+ */
+static inline pool_slab* pool_slab_of(void* block)
+{
+    return (pool_slab*)((std::uintptr_t)block & ~(std::uintptr_t)(pool_slab_size - 1));
+}
+
+/*
+ * Returns the pointer to the block of the slab.
+ */
+static inline char* pool_block(pool_slab* slab, size_t c, size_t i)
+{
+    return (char*)slab + pure_c::inline_value_offset(sizeof(pool_slab)) + (pool_min_block << c) * i;
+}
+
+/*
+ * Creates a new pool.
+ */
+pool* pool_create()
+{
+    pool* p = (pool*)std::malloc(sizeof(pool));
+    for(size_t c = 0; c < POOL_CLASSES; c++) {
+        p->_free[c] = NULL;
+        p->_current[c] = NULL;
+        p->_carved[c] = 0;
+    }
+    p->_slabs = NULL;
+    p->_allocated = 0;
+    return p;
+}
+
+/*
+ * Allocates a memory block.
+ * The block is taken from the list of free blocks, or from the current slab, or from a new slab.
+ */
+void* pool_alloc(pool* p, size_t size)
+{
+    size_t c = pool_class(size);
+    if(c == POOL_CLASSES) {
+        return std::malloc(size);
+    }
+    void* block = p->_free[c];
+    if(block != NULL) {
+        p->_free[c] = *(void**)block;
+        pool_slab_of(block)->used++;
+        return block;
+    }
+    const size_t capacity = (pool_slab_size - pure_c::inline_value_offset(sizeof(pool_slab))) / (pool_min_block << c);
+    if(p->_current[c] == NULL || p->_carved[c] == capacity) {
+        pool_slab* slab = (pool_slab*)std::aligned_alloc(pool_slab_size, pool_slab_size);
+        if(slab == NULL) {
+            return NULL;
+        }
+        slab->next = p->_slabs;
+        slab->used = 0;
+        p->_slabs = slab;
+        p->_current[c] = slab;
+        p->_carved[c] = 0;
+        p->_allocated++;
+    }
+    p->_current[c]->used++;
+    return pool_block(p->_current[c], c, p->_carved[c]++);
+}
+
+/*
+ * Returns the memory block into the pool.
+ */
+void pool_free(pool* p, void* block, size_t size)
+{
+    size_t c = pool_class(size);
+    if(c == POOL_CLASSES) {
+        free(block);
+        return;
+    }
+    *(void**)block = p->_free[c];
+    p->_free[c] = block;
+    pool_slab_of(block)->used--;
+}
+
+/*
+ * Releases the slabs, which have no used blocks.
+ * The free blocks of such slabs are removed from the lists before.
+ */
+size_t pool_shrink(pool* p)
+{
+    for(size_t c = 0; c < POOL_CLASSES; c++) {
+        void** link = &p->_free[c];
+        while(*link != NULL) {
+            if(pool_slab_of(*link)->used) {
+                link = (void**)*link;
+            } else {
+                *link = *(void**)*link;
+            }
+        }
+        if(p->_current[c] != NULL && !p->_current[c]->used) {
+            p->_current[c] = NULL;
+        }
+    }
+    size_t released = 0;
+    pool_slab** link = &p->_slabs;
+    while(*link != NULL) {
+        pool_slab* slab = *link;
+        if(slab->used) {
+            link = &slab->next;
+        } else {
+            *link = slab->next;
+            free(slab);
+            released++;
+        }
+    }
+    p->_allocated -= released;
+    return released;
+}
+
+/*
+ * Removes the pool and all the slabs from memory.
+ */
+void pool_delete(pool* p)
+{
+    while(p->_slabs != NULL) {
+        pool_slab* slab = p->_slabs;
+        p->_slabs = slab->next;
+        free(slab);
+    }
+    free(p);
+}
+} // namespace pure_c
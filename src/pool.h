@@ -0,0 +1,83 @@
+/**
+ * @file pool.h
+ *
+ * Contains the slab allocator `pool` for the C structures.
+ */
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+
+/*
+ * A declaration the structure `pool` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The number of the size classes of the pool.
+     * The sizes of the blocks are 32, 64, ..., 1024 bytes, the larger blocks are allocated by `malloc`.
+     */
+    enum
+    {
+        POOL_CLASSES = 6
+    };
+    /**
+     * The slab: the large memory page, which is divided into the blocks of the same size.
+     */
+    typedef struct pool_slab pool_slab;
+    /**
+     * The structure `pool`.
+     * The pool allocates the blocks from the slabs and keeps the released blocks in the lists of free blocks,
+     * so the structure, which adds and removes the elements, does not call `malloc` and `free` in the steady state.
+     * The pool is not thread-safe, each structure has its own pool.
+     */
+    typedef struct
+    {
+        void* _free[POOL_CLASSES];            //! the lists of free blocks of each size class.
+        pool_slab* _current[POOL_CLASSES];    //! the slab, which is divided now, of each size class.
+        size_t _carved[POOL_CLASSES];         //! the number of blocks taken from the current slab.
+        pool_slab* _slabs;                    //! the list of all the slabs.
+        size_t _allocated;                    //! the number of the allocated slabs.
+    } pool;
+    /**
+     * Creates a new pool.
+     * @return a new pool.
+     */
+    pool* pool_create(void);
+    /**
+     * Allocates a memory block.
+     * @param p the pointer to the pool.
+     * @param size the size of the block.
+     * @return the pointer to the block, the block is aligned as the `malloc` result.
+     */
+    void* pool_alloc(pool* p, size_t size);
+    /**
+     * Returns the memory block into the pool.
+     * @param p the pointer to the pool.
+     * @param block the pointer to the block.
+     * @param size the size, which was passed to `pool_alloc`.
+     */
+    void pool_free(pool* p, void* block, size_t size);
+    /**
+     * Releases the slabs, which have no used blocks.
+     * @param p the pointer to the pool.
+     * @return the number of the released slabs.
+     */
+    size_t pool_shrink(pool* p);
+    /**
+     * Removes the pool and all the slabs from memory.
+     * The blocks of the pool must not be used after this.
+     * @param p the pointer to the pool.
+     */
+    void pool_delete(pool* p);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* POOL_H */
@@ -13,9 +13,88 @@ queue *queue_create()
     q->_back = NULL;
     q->empty = 1;
     q->count = 0;
+    q->_element = 0;
+    q->_ring = NULL;
+    q->_capacity = 0;
+    q->_head = 0;
+    q->_pool = NULL;
     return q;
 }
 
+/*
+ * Creates a new queue with the pool of nodes and returns the pointer to queue.
+ */
+queue *queue_create_with_pool()
+{
+    queue *q = queue_create();
+    q->_pool = pool_create();
+    return q;
+}
+
+/*
+ * Allocates a node with the value.
+ */
+static inline queue_node *queue_alloc_node(queue *q, size_t size)
+{
+    return (queue_node *)(q->_pool ? pool_alloc(q->_pool, size) : std::malloc(size));
+}
+
+/*
+ * Releases a node.
+ */
+static inline void queue_free_node(queue *q, queue_node *node)
+{
+    if(q->_pool) {
+        pool_free(q->_pool, node, pure_c::inline_value_offset(sizeof(queue_node)) + node->_aligned);
+    } else {
+        free(node);
+    }
+}
+
+/*
+ * Creates a new queue of the elements of the same size.
+ * The capacity is rounded up to the power of two, so the position in the ring is found by a mask.
+ */
+queue *queue_create_fixed(size_t element_size, size_t initial_capacity)
+{
+    if(!element_size) {
+        return NULL;
+    }
+    size_t capacity = 1;
+    while(capacity < initial_capacity) {
+        capacity <<= 1;
+    }
+    queue *q = queue_create();
+    q->_element = element_size;
+    q->_capacity = capacity;
+    q->_ring = (char *)std::malloc(capacity * element_size);
+    return q;
+}
+
+/*
+ * Returns the pointer to the element of the ring buffer.
+ * `i` is the position from the first element.
+ */
+static inline char *queue_slot(const queue *q, size_t i)
+{
+    return q->_ring + ((q->_head + i) & (q->_capacity - 1)) * q->_element;
+}
+
+/*
+ * Doubles the capacity of the ring buffer.
+ * The elements, which are wrapped to the beginning of the buffer, are moved after the old end.
+ */
+static void queue_grow(queue *q)
+{
+    size_t capacity = q->_capacity;
+    q->_ring = (char *)std::realloc(q->_ring, 2 * capacity * q->_element);
+    if(q->_head + q->count > capacity) {
+        size_t wrapped = q->_head + q->count - capacity;
+        std::memcpy(q->_ring + capacity * q->_element, q->_ring, wrapped * q->_element);
+    }
+    q->_capacity = 2 * capacity;
+}
+
 /*
  * Removes the queue and all the elements from memory.
  */
@@ -24,21 +103,31 @@ void queue_delete(queue *q)
     while(q->_front) {
         queue_node *old = q->_front;
         q->_front = q->_front->next;
-        free(old->value);
-        free(old);
+        queue_free_node(q, old);
     }
+    if(q->_pool) {
+        pool_delete(q->_pool);
+    }
+    free(q->_ring);
     free(q);
 }
 
 /*
  * Inserts a new element into the queue.
  * Increases the size of the queue.
+ * The node and the value are allocated in one memory block.
  */
 void queue_enqueue(queue *q, const void *element, size_t length)
 {
-    queue_node *new_node = (queue_node *)std::malloc(sizeof(queue_node)); // a new node.
+    if(q->_element) {
+        queue_enqueue_n(q, element, 1);
+        return;
+    }
+    const size_t offset = pure_c::inline_value_offset(sizeof(queue_node));
+    queue_node *new_node = queue_alloc_node(q, offset + length); // a new node with the value.
     new_node->next = NULL;
-    new_node->value = pure_c::copy_memory_block(element, length); // copy a value.
+    new_node->value = (char *)new_node + offset;
+    std::memcpy(new_node->value, element, length); // copy a value.
     new_node->_aligned = length;
     if(q->empty) {
         q->_front = new_node;
@@ -52,25 +141,217 @@ void queue_enqueue(queue *q, const void *element, size_t length)
 }
 
 /*
- * Removes the first element from the queue and returns this element.
- * Reduces the size of the queue.
+ * Inserts the elements into the queue of the elements of the same size.
+ * The elements are copied by one or two blocks: before and after the end of the ring buffer.
  */
-void *queue_dequeue(queue *q)
+size_t queue_enqueue_n(queue *q, const void *elements, size_t n)
 {
-    void *value = NULL;
-    if(!q->empty) {
-        queue_node *temp = q->_front;
-        value = pure_c::copy_memory_block(q->_front->value, q->_front->_aligned); // gets a value from the element.
-        q->_front = q->_front->next;
-        free(temp->value);
-        free(temp);
-        q->count--;
+    if(!q->_element || !n) {
+        return 0;
+    }
+    while(q->count + n > q->_capacity) {
+        queue_grow(q);
+    }
+    size_t tail = (q->_head + q->count) & (q->_capacity - 1);
+    size_t first = n < q->_capacity - tail ? n : q->_capacity - tail;
+    std::memcpy(q->_ring + tail * q->_element, elements, first * q->_element);
+    std::memcpy(q->_ring, (const char *)elements + first * q->_element, (n - first) * q->_element);
+    q->count += (unsigned int)n;
+    q->empty = q->count == 0;
+    return n;
+}
+
+/*
+ * Removes the first elements from the queue of the elements of the same size.
+ * The elements are copied by one or two blocks: before and after the end of the ring buffer.
+ */
+size_t queue_dequeue_n(queue *q, void *buffer, size_t n)
+{
+    if(!q->_element || !n) {
+        return 0;
     }
+    n = n < q->count ? n : q->count;
+    size_t first = n < q->_capacity - q->_head ? n : q->_capacity - q->_head;
+    std::memcpy(buffer, q->_ring + q->_head * q->_element, first * q->_element);
+    std::memcpy((char *)buffer + first * q->_element, q->_ring, (n - first) * q->_element);
+    q->_head = (q->_head + n) & (q->_capacity - 1);
+    q->count -= (unsigned int)n;
+    q->empty = q->count == 0;
+    return n;
+}
+
+/*
+ * Inserts the elements of the different lengths into the queue.
+ * The nodes are linked into a chain, which is attached to the last node at once,
+ * so the queue is changed once for all the elements.
+ */
+size_t queue_enqueue_batch(queue *q, const void *const *elements, const size_t *lengths, size_t n)
+{
+    if(!n) {
+        return 0;
+    }
+    if(q->_element) {
+        while(q->count + n > q->_capacity) {
+            queue_grow(q);
+        }
+        for(size_t i = 0; i < n; i++) {
+            std::memcpy(queue_slot(q, q->count + i), elements[i], q->_element);
+        }
+        q->count += (unsigned int)n;
+        q->empty = 0;
+        return n;
+    }
+    const size_t offset = pure_c::inline_value_offset(sizeof(queue_node));
+    queue_node *first = NULL;
+    queue_node *last = NULL;
+    for(size_t i = 0; i < n; i++) {
+        queue_node *new_node = queue_alloc_node(q, offset + lengths[i]); // a new node with the value.
+        new_node->next = NULL;
+        new_node->value = (char *)new_node + offset;
+        std::memcpy(new_node->value, elements[i], lengths[i]);
+        new_node->_aligned = lengths[i];
+        if(last) {
+            last->next = new_node;
+        } else {
+            first = new_node;
+        }
+        last = new_node;
+    }
+    if(q->empty) {
+        q->_front = first;
+    } else {
+        q->_back->next = first;
+    }
+    q->_back = last;
+    q->count += (unsigned int)n;
+    q->empty = 0;
+    return n;
+}
+
+/*
+ * Removes the first elements from the queue and copies them into the buffers.
+ * The nodes are released one by one, the first node and the size of the queue are changed once.
+ */
+size_t queue_dequeue_batch(queue *q, void *const *buffers, const size_t *capacities, size_t *lengths, size_t n)
+{
+    size_t removed = 0;
+    if(q->_element) {
+        n = n < q->count ? n : q->count;
+        while(removed < n && q->_element <= capacities[removed]) {
+            std::memcpy(buffers[removed], queue_slot(q, removed), q->_element);
+            if(lengths) {
+                lengths[removed] = q->_element;
+            }
+            removed++;
+        }
+        q->_head = (q->_head + removed) & (q->_capacity - 1);
+        q->count -= (unsigned int)removed;
+        q->empty = q->count == 0;
+        return removed;
+    }
+    queue_node *node = q->_front;
+    while(removed < n && node != NULL && node->_aligned <= capacities[removed]) {
+        queue_node *next = node->next;
+        std::memcpy(buffers[removed], node->value, node->_aligned);
+        if(lengths) {
+            lengths[removed] = node->_aligned;
+        }
+        queue_free_node(q, node);
+        node = next;
+        removed++;
+    }
+    q->_front = node;
+    q->count -= (unsigned int)removed;
     if(!q->count) {
         q->_back = NULL;
         q->empty = 1;
     }
-    return value;
+    return removed;
+}
+
+/*
+ * Unlinks the first node from the queue.
+ * Reduces the size of the queue.
+ */
+static queue_node *queue_unlink_front(queue *q)
+{
+    queue_node *temp = q->_front;
+    q->_front = q->_front->next;
+    q->count--;
+    if(!q->count) {
+        q->_back = NULL;
+        q->empty = 1;
+    }
+    return temp;
+}
+
+/*
+ * Removes the first element from the queue and returns this element.
+ * The node is given to the caller: the value is moved to the beginning of the node.
+ */
+void *queue_dequeue(queue *q)
+{
+    if(q->empty) {
+        return NULL;
+    }
+    if(q->_element) {
+        void *value = std::malloc(q->_element);
+        queue_dequeue_n(q, value, 1);
+        return value;
+    }
+    queue_node *temp = queue_unlink_front(q);
+    if(q->_pool) {
+        void *value = pure_c::copy_memory_block(temp->value, temp->_aligned);
+        queue_free_node(q, temp);
+        return value;
+    }
+    std::memmove(temp, temp->value, temp->_aligned);
+    return temp;
+}
+
+/*
+ * Removes the first element from the queue and copies it into the buffer.
+ */
+size_t queue_dequeue_into(queue *q, void *buffer, size_t capacity)
+{
+    if(q->empty) {
+        return 0;
+    }
+    if(q->_element) {
+        if(q->_element <= capacity) {
+            queue_dequeue_n(q, buffer, 1);
+        }
+        return q->_element;
+    }
+    size_t length = q->_front->_aligned;
+    if(length <= capacity) {
+        queue_node *temp = queue_unlink_front(q);
+        std::memcpy(buffer, temp->value, length);
+        queue_free_node(q, temp);
+    }
+    return length;
+}
+
+/*
+ * Returns the first element of the queue without copying.
+ */
+const void *queue_peek_front(const queue *q)
+{
+    if(q->_element) {
+        return q->count ? queue_slot(q, 0) : NULL;
+    }
+    return q->_front != NULL ? q->_front->value : NULL;
+}
+
+/*
+ * Returns the last element of the queue without copying.
+ */
+const void *queue_peek_back(const queue *q)
+{
+    if(q->_element) {
+        return q->count ? queue_slot(q, q->count - 1) : NULL;
+    }
+    return q->_back != NULL ? q->_back->value : NULL;
 }
 
 /*
@@ -78,6 +359,9 @@ void *queue_dequeue(queue *q)
  */
 void *queue_front(queue *q)
 {
+    if(q->_element) {
+        return q->count ? pure_c::copy_memory_block(queue_slot(q, 0), q->_element) : NULL;
+    }
     void *value = NULL;
     if(q->_front != NULL) {
         value = pure_c::copy_memory_block(q->_front->value, q->_front->_aligned);
@@ -90,13 +374,26 @@ void *queue_front(queue *q)
  */
 void *queue_back(queue *q)
 {
+    if(q->_element) {
+        return q->count ? pure_c::copy_memory_block(queue_slot(q, q->count - 1), q->_element) : NULL;
+    }
     void *value = NULL;
     if(q->_back != NULL) {
-        value = pure_c::copy_memory_block(q->_back->value, q->_front->_aligned);
+        value = pure_c::copy_memory_block(q->_back->value, q->_back->_aligned);
     }
     return value;
 }
 
+/*
+ * Releases the idle slabs of the pool.
+ */
+void queue_shrink_to_fit(queue *q)
+{
+    if(q->_pool) {
+        pool_shrink(q->_pool);
+    }
+}
+
 /*
  * Returns the size of the queue.
  */
@@ -465,6 +465,8 @@ Queue<Type>::iterator::iterator(node_ptr node) : _node(node)
 
 #endif /* __cplusplus */
 
+#include "pool.h"
+
 /*
  * A declaration the structure `queue` for C.
  */
@@ -480,12 +482,14 @@ extern "C"
     typedef struct queue_node
     {
         size_t _aligned;  //! length of a type
-        void* value;      //! a pointer to the value.
+        void* value;      //! a pointer to the value, which is stored in the same memory block after the node.
         queue_node* next; //! a pointer to the next node.
     } queue_node;
     /**
      * The structure `queue`.
      * The queue is the structure "First-In-First-Out".
+     * The queue, which is created by `queue_create_fixed`, stores the elements in the ring buffer
+     * instead of the nodes.
      */
     typedef struct
     {
@@ -493,12 +497,39 @@ extern "C"
         queue_node* _back;  //! a pointer to the last node.
 	unsigned int count;
 	int empty;
+	size_t _element;    //! the size of the elements of the ring buffer, `0` - the queue of nodes.
+	char* _ring;        //! the ring buffer.
+	size_t _capacity;   //! the number of elements in the ring buffer, the power of two.
+	size_t _head;       //! the position of the first element in the ring buffer.
+	pool* _pool;        //! the pool of nodes, `NULL` - the nodes are allocated by `malloc`.
     } queue;
     /**
      * Creates a new queue and returns the pointer to queue.
      * @return a new queue.
      */
     queue* queue_create(void);
+    /**
+     * Creates a new queue of the elements of the same size.
+     * The elements are stored in the contiguous ring buffer, which grows twice, when it is full,
+     * so the elements are copied without the allocation for each element.
+     * The `length` argument of `queue_enqueue` is ignored for this queue.
+     * @param element_size the size of each element.
+     * @param initial_capacity the initial number of elements in the buffer.
+     * @return a new queue, `NULL` if the size of elements is `0`.
+     */
+    queue* queue_create_fixed(size_t element_size, size_t initial_capacity);
+    /**
+     * Creates a new queue, which allocates the nodes from its own pool.
+     * The released nodes are reused, so the queue in the steady state does not call `malloc` and `free`.
+     * `queue_dequeue` of this queue copies the element, use `queue_dequeue_into` to avoid the allocation.
+     * @return a new queue.
+     */
+    queue* queue_create_with_pool(void);
+    /**
+     * Releases the memory, which is not used by the elements: the idle slabs of the pool.
+     * @param q the pointer to the queue.
+     */
+    void queue_shrink_to_fit(queue* q);
     /**
      * Inserts a new element into the queue.
      * @param q the pointer to the queue.
@@ -508,12 +539,79 @@ extern "C"
     void queue_enqueue(queue* q, const void* element, size_t length = sizeof(void*));
     /**
      * Removes the first element from the queue.
-     * Returns the pointer to the deleted element.
+     * Returns the pointer to the deleted element, the memory of the element must be released by `free`.
+     * The element is moved to the beginning of its node, so the memory is not allocated
+     * (the queue, which is created by `queue_create_fixed`, copies the element).
      * If the queue is empty, returns the `NULL` pointer.
      * @param q the pointer to the queue.
      * @return the deleted element.
      */
     void* queue_dequeue(queue* q);
+    /**
+     * Inserts several elements into the queue, which is created by `queue_create_fixed`.
+     * @param q the pointer to the queue.
+     * @param elements the pointer to the array of elements.
+     * @param n the number of elements.
+     * @return the number of inserted elements, `0` if the queue is not created by `queue_create_fixed`.
+     */
+    size_t queue_enqueue_n(queue* q, const void* elements, size_t n);
+    /**
+     * Removes several first elements from the queue, which is created by `queue_create_fixed`,
+     * and copies them into the buffer.
+     * @param q the pointer to the queue.
+     * @param buffer the pointer to the memory for `n` elements.
+     * @param n the maximum number of elements.
+     * @return the number of removed elements, `0` if the queue is not created by `queue_create_fixed`.
+     */
+    size_t queue_dequeue_n(queue* q, void* buffer, size_t n);
+    /**
+     * Inserts several elements of the different lengths into the queue.
+     * The nodes are linked together and attached to the queue at once.
+     * The queue, which is created by `queue_create_fixed`, copies the elements of its size and ignores the lengths.
+     * @param q the pointer to the queue.
+     * @param elements the array of `n` pointers to the elements.
+     * @param lengths the array of `n` lengths of the elements.
+     * @param n the number of elements.
+     * @return the number of inserted elements.
+     */
+    size_t queue_enqueue_batch(queue* q, const void* const* elements, const size_t* lengths, size_t n);
+    /**
+     * Removes several first elements from the queue and copies them into the buffers, one element into one buffer.
+     * Stops, if the queue is empty or the buffer is less than the element, this element is not removed.
+     * @param q the pointer to the queue.
+     * @param buffers the array of `n` pointers to the memory for the elements.
+     * @param capacities the array of `n` sizes of the buffers.
+     * @param lengths the array of `n` lengths of the removed elements, can be `NULL`.
+     * @param n the maximum number of elements.
+     * @return the number of removed elements.
+     */
+    size_t queue_dequeue_batch(queue* q, void* const* buffers, const size_t* capacities, size_t* lengths, size_t n);
+    /**
+     * Removes the first element from the queue and copies it into the buffer.
+     * If the buffer is less than the element, the element is not removed.
+     * @param q the pointer to the queue.
+     * @param buffer the pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @return the length of the element, `0` if the queue is empty.
+     * If the result is more than the capacity, the element was not copied.
+     */
+    size_t queue_dequeue_into(queue* q, void* buffer, size_t capacity);
+    /**
+     * Returns the pointer to the first element, which is stored in the queue.
+     * The element is not copied: the pointer is valid while the element is in the queue.
+     * If the queue is empty, returns the `NULL` pointer.
+     * @param q a pointer to the queue.
+     * @return the first element.
+     */
+    const void* queue_peek_front(const queue* q);
+    /**
+     * Returns the pointer to the last element, which is stored in the queue.
+     * The element is not copied: the pointer is valid while the element is in the queue.
+     * If the queue is empty, returns the `NULL` pointer.
+     * @param q a pointer to the queue.
+     * @return the last element.
+     */
+    const void* queue_peek_back(const queue* q);
     /**
      * Returns a pointer to the first element in the queue.
      * If the queue is empty, returns the `NULL` pointer.
@@ -0,0 +1,396 @@
+#include "shm_queue.h"
+#include "extensions.h"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace pure_c
+{
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+              "The atomics in the shared memory must be lock-free.");
+
+/*
+ * The mark of the initialized segment: "SHMQUEUE".
+ */
+static const std::uint64_t shm_queue_magic = 0x53484D5155455545ull;
+
+/*
+ * The size of the cache line.
+ */
+static const size_t shm_queue_cache_line = 64;
+
+/*
+ * The slot header, the element follows it.
+ * The sequence of the slot tells, who can use it: the producer of the position `sequence`
+ * or the consumer of the position `sequence - 1`.
+ */
+struct shm_queue_slot
+{
+    std::atomic<std::uint64_t> sequence; //! the sequence of the slot.
+    std::uint64_t length;                //! the length of the element.
+};
+
+/*
+ * The header of the segment.
+ * The positions of the producers and the consumer and the futex words are on different cache lines.
+ */
+struct shm_queue_header
+{
+    std::atomic<std::uint64_t> magic;                                  //! `shm_queue_magic`, when the segment is ready.
+    std::uint64_t slot_size;                                           //! the maximum size of an element.
+    std::uint64_t stride;                                              //! the distance between the slots.
+    std::uint64_t slots;                                               //! the number of slots, the power of two.
+    std::uint64_t mode;                                                //! `SHM_QUEUE_SPSC` or `SHM_QUEUE_MPSC`.
+    alignas(shm_queue_cache_line) std::atomic<std::uint64_t> tail;     //! the next position of the producers.
+    alignas(shm_queue_cache_line) std::atomic<std::uint64_t> head;     //! the next position of the consumer.
+    alignas(shm_queue_cache_line) std::atomic<std::uint32_t> pushed;   //! the futex word, changed by each insertion.
+    std::atomic<std::uint32_t> consumers_waiting;                      //! the number of waiting consumers.
+    alignas(shm_queue_cache_line) std::atomic<std::uint32_t> popped;   //! the futex word, changed by each removal.
+    std::atomic<std::uint32_t> producers_waiting;                      //! the number of waiting producers.
+};
+
+/*
+ * The queue of the process: the mapped segment.
+ */
+struct shm_queue
+{
+    shm_queue_header* header; //! the header of the segment.
+    char* slots;              //! the first slot.
+    size_t size;              //! the size of the segment.
+};
+
+/*
+ * Rounds the size up to the cache line.
+ */
+static inline size_t shm_queue_round(size_t size)
+{
+    return (size + shm_queue_cache_line - 1) / shm_queue_cache_line * shm_queue_cache_line;
+}
+
+/*
+ * Returns the size of the segment.
+ */
+static inline size_t shm_queue_segment_size(size_t stride, size_t slots)
+{
+    return shm_queue_round(sizeof(shm_queue_header)) + stride * slots;
+}
+
+/*
+ * Returns the slot of the position.
+ */
+static inline shm_queue_slot* shm_queue_slot_at(const shm_queue* q, std::uint64_t position)
+{
+    return (shm_queue_slot*)(void*)(q->slots + (position & (q->header->slots - 1)) * q->header->stride);
+}
+
+/*
+ * Returns the element of the slot.
+ */
+static inline char* shm_queue_data(shm_queue_slot* slot)
+{
+    return (char*)(void*)slot + sizeof(shm_queue_slot);
+}
+
+/*
+ * Returns the current time of the monotonic clock in milliseconds.
+ */
+static inline long long shm_queue_now_ms()
+{
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/*
+ * Sleeps, while the futex word is equal to the seen value, but not after the deadline.
+ * Returns `0` if the deadline is over, otherwise `1`.
+ * Without futexes sleeps for a short time.
+ */
+static int shm_queue_sleep(std::atomic<std::uint32_t>* word, std::uint32_t seen, long long deadline)
+{
+    timespec timeout{0, 100000};
+    if(deadline >= 0) {
+        long long left = deadline - shm_queue_now_ms();
+        if(left <= 0) {
+            return 0;
+        }
+#ifdef __linux__
+        timeout.tv_sec = (time_t)(left / 1000);
+        timeout.tv_nsec = (long)(left % 1000) * 1000000;
+#endif
+    }
+#ifdef __linux__
+    syscall(SYS_futex, (std::uint32_t*)(void*)word, FUTEX_WAIT, seen, deadline >= 0 ? &timeout : NULL, NULL, 0);
+#else
+    if(word->load() == seen) {
+        nanosleep(&timeout, NULL);
+    }
+#endif
+    return 1;
+}
+
+/*
+ * Wakes all the processes, which sleep on the futex word.
+ */
+static inline void shm_queue_wake(std::atomic<std::uint32_t>* word)
+{
+#ifdef __linux__
+    syscall(SYS_futex, (std::uint32_t*)(void*)word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#else
+    (void)word;
+#endif
+}
+
+/*
+ * Returns the deadline of the timeout, `-1` - without the limit.
+ */
+static inline long long shm_queue_deadline(int timeout_ms)
+{
+    return timeout_ms < 0 ? -1 : shm_queue_now_ms() + timeout_ms;
+}
+
+/*
+ * Creates the handle of the mapped segment.
+ */
+static shm_queue* shm_queue_attach(void* memory, size_t size)
+{
+    shm_queue* q = (shm_queue*)std::malloc(sizeof(shm_queue));
+    q->header = (shm_queue_header*)memory;
+    q->slots = (char*)memory + shm_queue_round(sizeof(shm_queue_header));
+    q->size = size;
+    return q;
+}
+
+/*
+ * Creates the segment and the queue in it.
+ * The mark is written at the end, so other processes do not attach the segment before it is ready.
+ */
+shm_queue* shm_queue_create(const char* name, size_t slot_size, size_t slots, int mode)
+{
+    if(!slot_size || !slots || (mode != SHM_QUEUE_SPSC && mode != SHM_QUEUE_MPSC)) {
+        return NULL;
+    }
+    size_t capacity = 1;
+    while(capacity < slots) {
+        capacity <<= 1;
+    }
+    const size_t stride = shm_queue_round(sizeof(shm_queue_slot) + slot_size);
+    const size_t size = shm_queue_segment_size(stride, capacity);
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if(fd == -1) {
+        return NULL;
+    }
+    if(ftruncate(fd, (off_t)size) == -1) {
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+    void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(memory == MAP_FAILED) {
+        shm_unlink(name);
+        return NULL;
+    }
+    shm_queue_header* header = new(memory) shm_queue_header();
+    header->slot_size = slot_size;
+    header->stride = stride;
+    header->slots = capacity;
+    header->mode = (std::uint64_t)mode;
+    shm_queue* q = shm_queue_attach(memory, size);
+    for(size_t i = 0; i < capacity; i++) {
+        new(shm_queue_slot_at(q, i)) shm_queue_slot{{i}, 0};
+    }
+    header->magic.store(shm_queue_magic, std::memory_order_release);
+    return q;
+}
+
+/*
+ * Attaches the queue, which was created by another process.
+ */
+shm_queue* shm_queue_open(const char* name)
+{
+    int fd = shm_open(name, O_RDWR, 0);
+    if(fd == -1) {
+        return NULL;
+    }
+    struct stat info{};
+    if(fstat(fd, &info) == -1 || (size_t)info.st_size < sizeof(shm_queue_header)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)info.st_size;
+    void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(memory == MAP_FAILED) {
+        return NULL;
+    }
+    shm_queue_header* header = (shm_queue_header*)memory;
+    if(header->magic.load(std::memory_order_acquire) != shm_queue_magic
+       || shm_queue_segment_size(header->stride, header->slots) != size) {
+        munmap(memory, size);
+        return NULL;
+    }
+    return shm_queue_attach(memory, size);
+}
+
+/*
+ * Inserts the element without waiting.
+ * The producer takes the position, if the slot of the position is free: with a CAS for several producers.
+ * The element is published by the sequence of the slot.
+ */
+int shm_queue_push(shm_queue* q, const void* element, size_t length)
+{
+    shm_queue_header* h = q->header;
+    if(!length || length > h->slot_size) {
+        return -1;
+    }
+    std::uint64_t position = h->tail.load(std::memory_order_relaxed);
+    shm_queue_slot* slot = NULL;
+    for(;;) {
+        slot = shm_queue_slot_at(q, position);
+        auto difference = (std::int64_t)(slot->sequence.load(std::memory_order_acquire) - position);
+        if(difference == 0) {
+            if(h->mode == SHM_QUEUE_SPSC) {
+                h->tail.store(position + 1, std::memory_order_relaxed);
+                break;
+            }
+            if(h->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if(difference < 0) {
+            return 0; // the consumer has not released the slot yet.
+        } else {
+            position = h->tail.load(std::memory_order_relaxed);
+        }
+    }
+    slot->length = length;
+    std::memcpy(shm_queue_data(slot), element, length);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    h->pushed.fetch_add(1);
+    if(h->consumers_waiting.load()) {
+        shm_queue_wake(&h->pushed);
+    }
+    return 1;
+}
+
+/*
+ * Removes the first element without waiting.
+ * The slot is released for the producer of the next round.
+ */
+size_t shm_queue_pop(shm_queue* q, void* buffer, size_t capacity)
+{
+    shm_queue_header* h = q->header;
+    std::uint64_t position = h->head.load(std::memory_order_relaxed);
+    shm_queue_slot* slot = shm_queue_slot_at(q, position);
+    if(slot->sequence.load(std::memory_order_acquire) != position + 1) {
+        return 0;
+    }
+    size_t length = (size_t)slot->length;
+    if(length > capacity) {
+        return length;
+    }
+    std::memcpy(buffer, shm_queue_data(slot), length);
+    slot->sequence.store(position + h->slots, std::memory_order_release);
+    h->head.store(position + 1, std::memory_order_relaxed);
+    h->popped.fetch_add(1);
+    if(h->producers_waiting.load()) {
+        shm_queue_wake(&h->popped);
+    }
+    return length;
+}
+
+/*
+ * Inserts the element, waits for a free slot.
+ * The futex word is read before the second attempt, so a removal between
+ * the attempt and the sleep changes the word and the sleep returns at once.
+ */
+int shm_queue_push_wait(shm_queue* q, const void* element, size_t length, int timeout_ms)
+{
+    shm_queue_header* h = q->header;
+    const long long deadline = shm_queue_deadline(timeout_ms);
+    for(;;) {
+        int result = shm_queue_push(q, element, length);
+        if(result) {
+            return result;
+        }
+        std::uint32_t seen = h->popped.load();
+        h->producers_waiting.fetch_add(1);
+        result = shm_queue_push(q, element, length);
+        int waiting = result ? 1 : shm_queue_sleep(&h->popped, seen, deadline);
+        h->producers_waiting.fetch_sub(1);
+        if(result || !waiting) {
+            return result;
+        }
+    }
+}
+
+/*
+ * Removes the first element, waits for an element.
+ * The futex word is read before the second attempt, so an insertion between
+ * the attempt and the sleep changes the word and the sleep returns at once.
+ */
+size_t shm_queue_pop_wait(shm_queue* q, void* buffer, size_t capacity, int timeout_ms)
+{
+    shm_queue_header* h = q->header;
+    const long long deadline = shm_queue_deadline(timeout_ms);
+    for(;;) {
+        size_t result = shm_queue_pop(q, buffer, capacity);
+        if(result) {
+            return result;
+        }
+        std::uint32_t seen = h->pushed.load();
+        h->consumers_waiting.fetch_add(1);
+        result = shm_queue_pop(q, buffer, capacity);
+        int waiting = result ? 1 : shm_queue_sleep(&h->pushed, seen, deadline);
+        h->consumers_waiting.fetch_sub(1);
+        if(result || !waiting) {
+            return result;
+        }
+    }
+}
+
+/*
+ * Returns the number of elements.
+ */
+size_t shm_queue_count(const shm_queue* q)
+{
+    std::uint64_t head = q->header->head.load();
+    std::uint64_t tail = q->header->tail.load();
+    return tail > head ? (size_t)(tail - head) : 0;
+}
+
+/*
+ * Returns the maximum size of an element.
+ */
+size_t shm_queue_slot_size(const shm_queue* q)
+{
+    return (size_t)q->header->slot_size;
+}
+
+/*
+ * Detaches the queue from this process.
+ */
+void shm_queue_close(shm_queue* q)
+{
+    munmap(q->header, q->size);
+    free(q);
+}
+
+/*
+ * Removes the name of the segment.
+ */
+int shm_queue_unlink(const char* name)
+{
+    return shm_unlink(name);
+}
+} // namespace pure_c
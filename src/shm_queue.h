@@ -0,0 +1,120 @@
+/**
+ * @file shm_queue.h
+ *
+ * Contains the queue `shm_queue` in the shared memory for C.
+ */
+#ifndef SHM_QUEUE_H
+#define SHM_QUEUE_H
+
+#include <stddef.h>
+
+/*
+ * A declaration the structure `shm_queue` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The modes of the queue.
+     */
+    enum
+    {
+        SHM_QUEUE_SPSC = 0, //! one producer and one consumer.
+        SHM_QUEUE_MPSC = 1  //! several producers and one consumer.
+    };
+    /**
+     * The structure `shm_queue`.
+     * The queue "First-In-First-Out" of the fixed-size slots, which lives in the shared memory segment
+     * (`shm_open` and `mmap`), so several processes on the same host can attach it by the name.
+     * Adding and removing do not use locks and system calls; a process, which waits for an element
+     * or a free slot, sleeps on a futex and is woken only if it waits.
+     * Each process uses its own pointer, which is returned by `shm_queue_create` or `shm_queue_open`.
+     */
+    typedef struct shm_queue shm_queue;
+    /**
+     * Creates a new shared memory segment with the queue and attaches it.
+     * @param name the name of the segment, for example "/my_queue".
+     * @param slot_size the maximum size of an element.
+     * @param slots the number of slots, rounded up to the power of two.
+     * @param mode `SHM_QUEUE_SPSC` or `SHM_QUEUE_MPSC`.
+     * @return the queue, `NULL` if the segment cannot be created or already exists.
+     */
+    shm_queue* shm_queue_create(const char* name, size_t slot_size, size_t slots, int mode);
+    /**
+     * Attaches the queue, which was created by another process.
+     * @param name the name of the segment.
+     * @return the queue, `NULL` if the segment does not exist or is not a queue.
+     */
+    shm_queue* shm_queue_open(const char* name);
+    /**
+     * Inserts the element into the queue without waiting.
+     * @param q the pointer to the queue.
+     * @param element the pointer to the element.
+     * @param length the length of the element, from `1` to the size of a slot.
+     * @return `1` if the element is inserted, `0` if the queue is full, `-1` if the length is wrong.
+     */
+    int shm_queue_push(shm_queue* q, const void* element, size_t length);
+    /**
+     * Inserts the element into the queue, waits for a free slot, if the queue is full.
+     * @param q the pointer to the queue.
+     * @param element the pointer to the element.
+     * @param length the length of the element, from `1` to the size of a slot.
+     * @param timeout_ms the maximum time of waiting in milliseconds, negative - without the limit.
+     * @return `1` if the element is inserted, `0` if the time is over, `-1` if the length is wrong.
+     */
+    int shm_queue_push_wait(shm_queue* q, const void* element, size_t length, int timeout_ms);
+    /**
+     * Removes the first element from the queue without waiting and copies it into the buffer.
+     * Only one process or thread can remove the elements.
+     * If the buffer is less than the element, the element is not removed.
+     * @param q the pointer to the queue.
+     * @param buffer the pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @return the length of the element, `0` if the queue is empty.
+     * If the result is more than the capacity, the element was not copied.
+     */
+    size_t shm_queue_pop(shm_queue* q, void* buffer, size_t capacity);
+    /**
+     * Removes the first element from the queue, waits for an element, if the queue is empty.
+     * @param q the pointer to the queue.
+     * @param buffer the pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @param timeout_ms the maximum time of waiting in milliseconds, negative - without the limit.
+     * @return the length of the element, `0` if the time is over.
+     */
+    size_t shm_queue_pop_wait(shm_queue* q, void* buffer, size_t capacity, int timeout_ms);
+    /**
+     * Returns the number of elements in the queue.
+     * The result is approximate, if other processes change the queue.
+     * @param q the pointer to the queue.
+     * @return the number of elements.
+     */
+    size_t shm_queue_count(const shm_queue* q);
+    /**
+     * Returns the maximum size of an element.
+     * @param q the pointer to the queue.
+     * @return the size of a slot.
+     */
+    size_t shm_queue_slot_size(const shm_queue* q);
+    /**
+     * Detaches the queue from this process.
+     * The segment exists until `shm_queue_unlink` is called.
+     * @param q the pointer to the queue.
+     */
+    void shm_queue_close(shm_queue* q);
+    /**
+     * Removes the name of the segment, the memory is released, when all the processes detach it.
+     * @param name the name of the segment.
+     * @return `0` if the name is removed, otherwise `-1`.
+     */
+    int shm_queue_unlink(const char* name);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SHM_QUEUE_H */
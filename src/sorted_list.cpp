@@ -1,4 +1,205 @@
 /*
  * This file required to create the `.so` library.
+ * Also, it contains the C interface of the `sorted_list` class.
  */
 #include "sorted_list.h"
+#include "type_erased.h"
+#include <algorithm>
+#include <vector>
+
+namespace pure_c
+{
+using _helpers_type_erased::element;
+using _helpers_type_erased::element_iterator;
+using _helpers_type_erased::element_type;
+
+/*
+ * The interface of the lists, which store the elements of the different capacities.
+ */
+struct c_sorted_list_core
+{
+    virtual ~c_sorted_list_core() = default;
+    virtual void push(const void* value) = 0;
+    virtual void push_n(const void* values, size_t n) = 0;
+    virtual int pop_front(void* buffer) = 0;
+    virtual int pop_back(void* buffer) = 0;
+    virtual int remove(size_t pos, void* buffer) = 0;
+    virtual int at(size_t pos, void* buffer) const = 0;
+    virtual size_t count() const = 0;
+    virtual void clear() = 0;
+};
+
+/*
+ * The list of the elements of the capacity `N`.
+ */
+template<size_t N>
+class c_sorted_list_engine final : public c_sorted_list_core
+{
+  public:
+    explicit c_sorted_list_engine(const element_type* t) : type(t), list() {}
+    c_sorted_list_engine(const c_sorted_list_engine&) = delete;
+    c_sorted_list_engine& operator=(const c_sorted_list_engine&) = delete;
+
+    void push(const void* value) override { list.push(element<N>::make(type, value)); }
+    /*
+     * The list starts the search of the position from the last inserted element,
+     * so the sorted elements are inserted without the walk through the list.
+     */
+    void push_n(const void* values, size_t n) override
+    {
+        element_iterator<N> first(type, values);
+        element_iterator<N> last(type, static_cast<const unsigned char*>(values) + n * type->size);
+        std::vector<element<N>> sorted(first, last);
+        std::sort(sorted.begin(), sorted.end());
+        for(auto& e : sorted) {
+            list.push(std::move(e));
+        }
+    }
+    int pop_front(void* buffer) override
+    {
+        if(list.is_empty()) {
+            return 0;
+        }
+        copy(list.pop_front(), buffer);
+        return 1;
+    }
+    int pop_back(void* buffer) override
+    {
+        if(list.is_empty()) {
+            return 0;
+        }
+        copy(list.pop_back(), buffer);
+        return 1;
+    }
+    int remove(size_t pos, void* buffer) override
+    {
+        if(pos >= list.count()) {
+            return 0;
+        }
+        copy(list.remove(static_cast<int>(pos)), buffer);
+        return 1;
+    }
+    int at(size_t pos, void* buffer) const override
+    {
+        if(pos >= list.count()) {
+            return 0;
+        }
+        list.at(static_cast<int>(pos)).copy_to(buffer);
+        return 1;
+    }
+    size_t count() const override { return list.count(); }
+    void clear() override { list.clear(); }
+
+  private:
+    /*
+     * Copies the removed element, if the buffer is passed.
+     */
+    static inline void copy(const element<N>& e, void* buffer)
+    {
+        if(buffer != NULL) {
+            e.copy_to(buffer);
+        }
+    }
+
+    const element_type* type;       //! the type of the elements.
+    ::sorted_list<element<N>> list; //! the list.
+};
+
+/*
+ * The structure `c_sorted_list`: the type of the elements and the list.
+ */
+struct c_sorted_list
+{
+    element_type type;
+    c_sorted_list_core* core;
+};
+
+/*
+ * Creates a new list, chooses the capacity of the elements by their size.
+ */
+c_sorted_list* c_sorted_list_create(size_t element_size, int (*compare)(const void*, const void*))
+{
+    c_sorted_list* l = new c_sorted_list{{element_size, compare, NULL}, NULL};
+    l->core = _helpers_type_erased::make_engine<c_sorted_list_engine, c_sorted_list_core>(&l->type);
+    if(l->core == NULL) {
+        delete l;
+        return NULL;
+    }
+    return l;
+}
+
+/*
+ * Inserts a copy of the element into the list.
+ */
+void c_sorted_list_push(c_sorted_list* l, const void* element)
+{
+    l->core->push(element);
+}
+
+/*
+ * Inserts the array of the elements into the list.
+ */
+void c_sorted_list_push_n(c_sorted_list* l, const void* elements, size_t n)
+{
+    if(n) {
+        l->core->push_n(elements, n);
+    }
+}
+
+/*
+ * Removes the first element and copies it into the buffer.
+ */
+int c_sorted_list_pop_front(c_sorted_list* l, void* buffer)
+{
+    return l->core->pop_front(buffer);
+}
+
+/*
+ * Removes the last element and copies it into the buffer.
+ */
+int c_sorted_list_pop_back(c_sorted_list* l, void* buffer)
+{
+    return l->core->pop_back(buffer);
+}
+
+/*
+ * Removes the element from the position and copies it into the buffer.
+ */
+int c_sorted_list_remove(c_sorted_list* l, size_t pos, void* buffer)
+{
+    return l->core->remove(pos, buffer);
+}
+
+/*
+ * Copies the element from the position into the buffer.
+ */
+int c_sorted_list_at(const c_sorted_list* l, size_t pos, void* buffer)
+{
+    return l->core->at(pos, buffer);
+}
+
+/*
+ * Returns the number of elements.
+ */
+size_t c_sorted_list_count(const c_sorted_list* l)
+{
+    return l->core->count();
+}
+
+/*
+ * Removes all the elements from the list.
+ */
+void c_sorted_list_clear(c_sorted_list* l)
+{
+    l->core->clear();
+}
+
+/*
+ * Removes the list from memory.
+ */
+void c_sorted_list_delete(c_sorted_list* l)
+{
+    delete l->core;
+    delete l;
+}
+} // namespace pure_c
@@ -14,6 +14,9 @@
 #include <stdexcept>
 #include <functional>
 #include <memory>
+#include <deque>
+#include <vector>
+#include <algorithm>
 
 /**
  * This class implements a sorted list.
@@ -64,6 +67,7 @@ class sorted_list
     friend std::ostream& operator<<(std::ostream& stream, const sorted_list<T>& list);
 
   public:
+    class handle;
     /**
      * Constructor.
      * @param func a custom function to compare elements.
@@ -116,6 +120,44 @@ class sorted_list
      * @return position.
      */
     unsigned int push(const Num& element);
+    /**
+     * Inserts a new element into the list, like the `push` function,
+     * but returns a stable handle to the inserted element instead of the position.
+     * The handle stays valid until the element is removed from the list.
+     * @param element - a new element.
+     * @return handle to the element.
+     */
+    handle push_handle(Num&& element);
+    /**
+     * The same `push_handle` function, but for l-value.
+     * @param element - a new element.
+     * @return handle to the element.
+     */
+    handle push_handle(const Num& element);
+    /**
+     * Removes the element by the handle and returns it.
+     * The element is unlinked in constant time.
+     * If the handle is invalid, throws the `invalid_argument` exception.
+     * @param h - handle to the element.
+     * @return the removed element.
+     */
+    Num erase(const handle& h);
+    /**
+     * Changes the value of the element by the handle and moves the element
+     * to a new position to save the order of the list.
+     * The search starts from the current position of the element,
+     * so the complexity depends only on the distance to a new position.
+     * If the handle is invalid, throws the `invalid_argument` exception.
+     * @param h - handle to the element.
+     * @param value - a new value.
+     */
+    void update(const handle& h, Num&& value);
+    /**
+     * The same `update` function, but for l-value.
+     * @param h - handle to the element.
+     * @param value - a new value.
+     */
+    void update(const handle& h, const Num& value);
     /**
      * Removes the last element from the list and returns it.
      * If the list is empty, the result has an undefined behavior.
@@ -185,6 +227,41 @@ class sorted_list
      * @return an element from the position.
      */
     Num operator[](int pos) const noexcept;
+    /**
+     * Returns the quantile of the elements, using the nearest rank.
+     * For example: `quantile(0)` - the minimum element, `quantile(1)` - the maximum element.
+     * The position is found from the nearest end of the list.
+     * If the list is empty or `q` is not in the range `[0, 1]`, throws the `out_of_range` exception.
+     * @param q - a quantile, from 0 to 1.
+     * @return an element.
+     */
+    Num quantile(double q) const;
+    /**
+     * The same `quantile(0.5)` function.
+     * @return the median element.
+     */
+    inline Num median() const { return quantile(0.5); }
+    /**
+     * Returns several quantiles of the elements for one pass through the list.
+     * For example: `list.quantiles({0.5, 0.99, 0.999})`.
+     * If the list is empty or any `q` is not in the range `[0, 1]`, throws the `out_of_range` exception.
+     * @param qs - quantiles, from 0 to 1.
+     * @return elements in the same order as the quantiles.
+     */
+    std::vector<Num> quantiles(const std::vector<double>& qs) const;
+    /**
+     * Sets the size of the sliding window.
+     * If the window is set, the list keeps only the last inserted elements:
+     * when the number of elements exceeds the window, the oldest element is removed.
+     * The window `0` disables this mode. The window is not copied to another list,
+     * because the order of insertion is not copied.
+     * @param size - the number of elements in the window.
+     */
+    void set_window(unsigned int size);
+    /**
+     * @return the size of the sliding window, `0` if the window is not set.
+     */
+    inline unsigned int window() const noexcept { return _window; }
 
   private:
     /**
@@ -192,16 +269,32 @@ class sorted_list
      */
     inline bool is_out_of_range(int pos) const { return (pos < 0 || static_cast<unsigned int>(pos) > _count) || !(_count); }
     /**
-     * Calls a custom function for comparison elements.
-     * Increments the position.
+     * Inserts a new element and returns its node, the node becomes the last inserted node.
+     * The search starts from the last inserted node and uses the custom function, if it exists.
      * The custom function must get 2 arguments and must return `true` or `false`.
      * For example: `[](a, b) {  return (a <= b); }`.
+     * @param with_pos `true` if the position of the element is needed, it is recounted, if it is unknown.
      */
-    void push_with_custom_func(Num&& element, unsigned int& pos);
+    node_ptr insert_node(Num&& element, bool with_pos);
     /**
      * Copy all the elements to this list.
      */
     void assign(node_ptr front);
+    /**
+     * Returns the node by the handle.
+     * If the handle is invalid, throws the `invalid_argument` exception.
+     */
+    node_ptr node_from_handle(const handle& h) const;
+    /**
+     * Removes the node from the list, but does not free it.
+     */
+    void unlink(const node_ptr& node) noexcept;
+    /**
+     * Moves the last inserted node to its neighbor, if this node is removed.
+     * Must be called before the node is unlinked.
+     * @param before `true` if the removed node is before the last inserted node.
+     */
+    void release_last_node(const node_ptr& node, bool before) noexcept;
 
   private:
     node_ptr _front;        //! a pointer to the first element.
@@ -210,62 +303,56 @@ class sorted_list
     bool _empty{true};
     bool reversed{false};
     custom_func cmp_func;
-    node_ptr last_node;       //! the last inserted node.
-    unsigned int last_pos{0}; //! the last position.
+    node_ptr last_node;          //! the last inserted node.
+    unsigned int last_pos{0};    //! the last position.
+    bool last_pos_known{true};   //! `false` if a node was removed or moved, and its side of the last node is unknown.
+    unsigned int _window{0};  //! the size of the sliding window.
+    std::deque<std::weak_ptr<Node>> history; //! inserted nodes in the order of insertion, used by the window.
   private:
     /**
-     * Enumeration for selecting elements.
-     * Used in the comparison function `cmp_operator`.
+     * Returns the position of the quantile.
+     * If the list is empty or `q` is not in the range `[0, 1]`, throws the `out_of_range` exception.
      */
-    enum class index
-    {
-        FIRST, //! the first element.
-        LAST,  //! the last element.
-        MIDDLE //! any element between the first and last.
-    };
+    unsigned int quantile_pos(double q) const;
+    /**
+     * Removes the oldest elements, while the number of elements exceeds the window.
+     */
+    void expire();
     /**
-     * The comparison function.
-     * Compares the current element with a new element.
-     * Used to sort elements in the list.
+     * Adds the last inserted node to the window.
      */
-    inline bool cmp_operator(const node_ptr& head, const Num& element, index ind = index::MIDDLE) const noexcept
+    inline void push_to_window()
     {
-        switch(ind) {
-        case index::LAST:
-            // compares the last element.
-            return (reversed ? _back->value >= element : _back->value <= element);
-        case index::FIRST:
-            // compares the first element.
-            return (reversed ? _front->value <= element : _front->value >= element);
-        case index::MIDDLE:
-        default:
-            // compares the middle element.
-            // Calls the function `greater` if the order of the list is reversed,
-            // otherwise calls the function `less`.
-            return (reversed ? greater(head, element) : less(head, element));
+        if(_window) {
+            history.emplace_back(last_node);
+            expire();
         }
     }
     /**
-     * The comparison function.
-     * Used when the order of the list isn`t reversed.
+     * Returns `true` if the node is in the list.
+     * The removed node is not linked with its neighbors.
      */
-    inline bool less(const node_ptr& head, const Num& element) const
+    inline bool is_linked(const node_ptr& node) const noexcept
     {
-        return (head->value <= element && head->next && head->next->value >= element);
+        return node && (node->prev ? node->prev->next == node : _front == node);
     }
+
     /**
-     * The comparison function.
-     * Used when the order of the list is reversed.
+     * Enumeration for selecting the place of a new node.
+     * Used in the function `create_new_node`.
      */
-    inline bool greater(const node_ptr& head, const Num& element) const
+    enum class index
     {
-        return (head->value >= element && head->next && head->next->value <= element);
-    }
+        FIRST, //! the first element.
+        LAST,  //! the last element.
+        MIDDLE //! any element between the first and last.
+    };
     /**
      * Creates a new node, with a new value and inserts this node in
      * the special position to save the sorted order.
+     * Returns the new node.
      */
-    inline void create_new_node(const node_ptr& head, Num&& element, index i = index::MIDDLE)
+    inline node_ptr create_new_node(const node_ptr& head, Num&& element, index i = index::MIDDLE)
     {
         switch(i) {
         // Before the first element.
@@ -273,14 +360,14 @@ class sorted_list
             node_ptr new_node = make_shared_ptr<Node>(std::forward<Num>(element), _front, nullptr);
             _front->prev = new_node; // sets the old first element.
             _front = new_node;       // changes the first element.
-            break;
+            return new_node;
         }
         // After the last element.
         case index::LAST: {
             node_ptr new_node = make_shared_ptr<Node>(std::forward<Num>(element), nullptr, _back);
             _back->next = new_node; // sets the old last element.
             _back = new_node;       // changes the last element.
-            break;
+            return new_node;
 	}
 	case index::MIDDLE:
 	default: {
@@ -293,7 +380,7 @@ class sorted_list
 	    node_ptr new_node = make_shared_ptr<Node>(std::forward<Num>(element), head->next, head);
 	    head->next->prev = new_node;
 	    head->next = new_node;
-	    break;
+	    return new_node;
 	}
 	}
     }
@@ -301,6 +388,56 @@ class sorted_list
      * Sets the last node which was inserted.
      */
     inline void set_last_node(const node_ptr& last, unsigned int pos) { last_node = last, last_pos = pos; }
+    /**
+     * Returns `true` if the first element can be placed before the second element.
+     * Uses the custom function if it exists, otherwise `<=` (`>=` if the list is reversed).
+     */
+    inline bool in_order(const Num& first, const Num& second) const
+    {
+        if(cmp_func != nullptr) {
+            return cmp_func(first, second);
+        }
+        return (reversed ? first >= second : first <= second);
+    }
+
+  public:
+    /**
+     * The handle to an element of the sorted list.
+     * Unlike positions, the handle does not change when other
+     * elements are inserted or removed.
+     */
+    class handle
+    {
+        /**
+         * Makes the `sorted_list` class friend.
+         */
+        friend class sorted_list<Num>;
+
+      private:
+        /**
+         * Constructor.
+         */
+        explicit handle(const node_ptr& node) : _node(node) {}
+
+      public:
+        /**
+         * Default constructor.
+         */
+        handle() = default;
+        /**
+         * @return `true` if the element still exists, otherwise `false`.
+         */
+        inline bool is_valid() const noexcept { return !_node.expired(); }
+        /**
+         * Returns a value of the element.
+         * If the handle is invalid, the result has an undefined behavior.
+         * @return a value.
+         */
+        inline const Num& operator*() const noexcept { return _node.lock()->value; }
+
+      private:
+        std::weak_ptr<Node> _node; //! a pointer to the node.
+    };
 
   public:
     /**
@@ -442,7 +579,8 @@ sorted_list<Num>::Node::Node(const Num& e, std::shared_ptr<Node> n, std::shared_
  * Constructor.
  */
 template<typename Num>
-sorted_list<Num>::sorted_list(const custom_func& func) : _front(nullptr), _back(nullptr), cmp_func(func), last_node(nullptr)
+sorted_list<Num>::sorted_list(const custom_func& func) :
+    _front(nullptr), _back(nullptr), cmp_func(func), last_node(nullptr), history()
 {}
 
 /*
@@ -450,7 +588,8 @@ sorted_list<Num>::sorted_list(const custom_func& func) : _front(nullptr), _back(
  */
 template<typename Num>
 sorted_list<Num>::sorted_list(const sorted_list<Num>& orig) :
-    _front(nullptr), _back(nullptr), _count(orig._count), _empty(orig._empty), cmp_func(orig.cmp_func), last_node(nullptr)
+    _front(nullptr), _back(nullptr), _count(orig._count), _empty(orig._empty), cmp_func(orig.cmp_func), last_node(nullptr),
+    history()
 {
     assign(orig._front);
 }
@@ -461,13 +600,16 @@ sorted_list<Num>::sorted_list(const sorted_list<Num>& orig) :
 template<typename Num>
 sorted_list<Num>::sorted_list(sorted_list<Num>&& orig) noexcept :
     _front(orig._front), _back(orig._back), _count(orig._count), _empty(orig._empty), reversed(orig.reversed),
-    cmp_func(orig.cmp_func), last_node(orig.last_node), last_pos(orig.last_pos)
+    cmp_func(orig.cmp_func), last_node(orig.last_node), last_pos(orig.last_pos), last_pos_known(orig.last_pos_known),
+    _window(orig._window),
+    history(std::move(orig.history))
 {
     orig._front = nullptr, orig._back = nullptr;
     orig._count = 0;
     orig._empty = true, orig.reversed = false;
     orig.cmp_func = nullptr;
-    orig.last_node = nullptr, orig.last_pos = 0;
+    orig.last_node = nullptr, orig.last_pos = 0, orig.last_pos_known = true;
+    orig._window = 0;
 }
 
 /*
@@ -475,7 +617,7 @@ sorted_list<Num>::sorted_list(sorted_list<Num>&& orig) noexcept :
  */
 template<typename Num>
 sorted_list<Num>::sorted_list(std::initializer_list<Num> lst, const custom_func& func) :
-    _front(nullptr), _back(nullptr), cmp_func(func), last_node(nullptr)
+    _front(nullptr), _back(nullptr), cmp_func(func), last_node(nullptr), history()
 {
     /*
      * Just copy all the elements.
@@ -521,13 +663,16 @@ sorted_list<Num>& sorted_list<Num>::operator=(sorted_list<Num>&& orig) noexcept
     _count = orig._count;
     _empty = orig._empty, reversed = orig.reversed;
     cmp_func = orig.cmp_func;
-    last_node = nullptr, last_pos = 0;
+    last_node = orig.last_node, last_pos = orig.last_pos, last_pos_known = orig.last_pos_known;
+    _window = orig._window;
+    history = std::move(orig.history);
 
     orig._front = nullptr, orig._back = nullptr;
     orig._count = 0;
     orig._empty = true, orig.reversed = false;
     orig.cmp_func = nullptr;
-    orig.last_node = nullptr, orig.last_pos = 0;
+    orig.last_node = nullptr, orig.last_pos = 0, orig.last_pos_known = true;
+    orig._window = 0;
     return *this;
 }
 
@@ -540,59 +685,9 @@ sorted_list<Num>& sorted_list<Num>::operator=(sorted_list<Num>&& orig) noexcept
 template<typename Num>
 unsigned int sorted_list<Num>::push(Num&& element)
 {
-    unsigned int pos = 0;
-    if(!_empty) {
-        if(cmp_func != nullptr) {
-            push_with_custom_func(std::move(element), pos);
-            return pos;
-        }
-        /*
-         * Compare the first element of the list with a new element.
-         * If a new element `<` (`>` if the list is reverse)
-         * than the first element, then a new element is inserted in the position `0`.
-         */
-        if(cmp_operator(nullptr, element, index::FIRST)) {
-            create_new_node(nullptr, std::forward<Num>(element), index::FIRST);
-            set_last_node(_front, pos);
-        } else if(cmp_operator(nullptr, element, index::LAST)) {
-            /*
-             * Compare the last element from the list with a new element.
-             * if a new element `>` (`<` if the list is reverse)
-             * than the last element, then a new element is inserted in the last position.
-             */
-            create_new_node(nullptr, std::forward<Num>(element), index::LAST);
-            pos = _count - 1;
-            set_last_node(_back, pos);
-        } else {
-            /*
-             * Compare all the elements from the list with a new element.
-             * if a new element `<` (`>` if the list is reversed)
-             * than any element, a new element is inserted in this position.
-             */
-            node_ptr head = last_node; // the last inserted element.
-            pos = last_pos;
-            while(head) {
-                if(cmp_operator(head, element)) {
-                    create_new_node(head, std::forward<Num>(element));
-                    set_last_node(head->next, pos);
-                    break;
-		}
-		/*
-		 * If the last inserted element less than a new element,
-		 * the insertion position located in the right side:
-		 * (the last inserted element ... end of the list)
-		 * Otherwise the insertion position located in the left side:
-		 * (beginning of the list ... the last inserted element).
-		 */
-		head = (last_node->value <= element) ? head->next : head->prev;
-		++pos;
-	    }
-	}
-    } else {
-        _front = _back = make_shared_ptr<Node>(std::forward<Num>(element), nullptr, nullptr);
-        _empty = false;
-    }
-    _count++;
+    insert_node(std::move(element), true);
+    const unsigned int pos = last_pos;
+    push_to_window();
     return pos;
 }
 
@@ -603,67 +698,201 @@ unsigned int sorted_list<Num>::push(const Num& element)
 }
 
 /*
- * Calls the user function to compare elements.
- * Increments a position.
+ * The `push_handle` function.
+ * Inserts an element like the `push` function, but does not need its position.
  */
 template<typename Num>
-void sorted_list<Num>::push_with_custom_func(Num&& element, unsigned int& pos)
+typename sorted_list<Num>::handle sorted_list<Num>::push_handle(Num&& element)
 {
+    node_ptr node = insert_node(std::move(element), false);
+    push_to_window();
+    return handle(node);
+}
+
+template<typename Num>
+typename sorted_list<Num>::handle sorted_list<Num>::push_handle(const Num& element)
+{
+    return push_handle(Num(element));
+}
+
+/*
+ * The `erase` function.
+ * Removes the element by the handle and returns it.
+ */
+template<typename Num>
+Num sorted_list<Num>::erase(const handle& h)
+{
+    node_ptr node = node_from_handle(h);
+    if(node != last_node && node->prev && node->next) {
+        // The side of the node is unknown, the position of the last inserted node is recounted by the next `push`.
+        last_pos_known = false;
+    }
+    release_last_node(node, !node->prev);
+    unlink(node);
+    _count--;
+    _empty = _count == 0;
+    return std::move(node->value);
+}
+
+/*
+ * The `update` function.
+ * Changes the value of the element and moves it to a new position.
+ */
+template<typename Num>
+void sorted_list<Num>::update(const handle& h, Num&& value)
+{
+    node_ptr node = node_from_handle(h);
+    node_ptr left = node->prev, right = node->next;
+    const node_ptr old_left = left;
+    unlink(node);
+    node->value = std::move(value);
     /*
-     * Compares the first element from the list with a new element.
-     * Call the custom function with 2 parameters:
-     * `func(a new element, the first element)`.
-     * If a new element less than the first element,
-     * a new element is inserted in the position `0`.
-     */
-    if(cmp_func(element, _front->value)) {
-        create_new_node(nullptr, std::forward<Num>(element), index::FIRST);
-        set_last_node(_front, pos);
-    } else if(cmp_func(_back->value, element)) {
-        /*
-         * Compares the last element from the list with a new element.
-         * Call the custom function with 2 parameters:
-         * `func(the last element, a new element)`.
-         * If a new element more than the last element,
-         * a new element is inserted in the last position.
-         */
-        create_new_node(nullptr, std::forward<Num>(element), index::LAST);
-        set_last_node(_back, pos);
-        pos = _count - 1;
+     * Only one of these loops moves: to the beginning of the list
+     * if a new value is less than the previous element,
+     * or to the end of the list if a new value is more than the next element.
+     */
+    while(left && !in_order(left->value, node->value)) {
+        right = left;
+        left = left->prev;
+    }
+    while(right && !in_order(node->value, right->value)) {
+        left = right;
+        right = right->next;
+    }
+    if(left != old_left) {
+        // The node is moved, it can cross the last inserted node.
+        last_pos_known = false;
+    }
+    // Inserts the node between `left` and `right`.
+    node->prev = left, node->next = right;
+    if(left) {
+        left->next = node;
     } else {
-        /*
-         * Compares all the elements of the list with a new element.
-         * A new element must be more(less if the order of the list is reversed)
-         * than the prevoius element. For example: 2 <= 3,
-         * or if the order of the list is reversed: 3 >= 2.
-	 * Call the custom function with 2 parameters:
-	 * `func(the previous element, a new element)`.
-	 */
-	node_ptr head = last_node; // the last inserted element.
-	pos = last_pos;
-	/*
-	 * If the last inserted element less than a new element,
-	 * the insertion position located in the right side:
-	 * (the last inserted element ... end of the list)
-	 * Otherwise the insertion position located in the left side:
-	 * (beginning of the list ... the last inserted element).
-	 */
-	bool right = cmp_func(last_node->value, element);
-	node_ptr next = right ? last_node->next : last_node->prev; // sets the next element.
-
-	while(head && next) {
-	    if(cmp_func(head->value, element)) {
-		create_new_node(head, std::forward<Num>(element));
-		set_last_node(head->next, pos);
-		break;
-	    }
-
-	    head = right ? head->next : head->prev;
-	    next = right ? next->next : next->prev;
-	    ++pos;
-	}
+        _front = node;
+    }
+    if(right) {
+        right->prev = node;
+    } else {
+        _back = node;
+    }
+}
+
+template<typename Num>
+void sorted_list<Num>::update(const handle& h, const Num& value)
+{
+    update(h, Num(value));
+}
+
+/*
+ * Returns the node by the handle.
+ * The node must be linked with its neighbors, otherwise
+ * the node was removed from the list.
+ */
+template<typename Num>
+typename sorted_list<Num>::node_ptr sorted_list<Num>::node_from_handle(const handle& h) const
+{
+    node_ptr node = h._node.lock();
+    if(!is_linked(node)) {
+        throw std::invalid_argument("Error: the handle is invalid.");
+    }
+    return node;
+}
+
+/*
+ * Removes the node from the list.
+ * Resets the pointers of the node, so the node is freed with the last owner.
+ */
+template<typename Num>
+void sorted_list<Num>::unlink(const node_ptr& node) noexcept
+{
+    if(node->prev) {
+        node->prev->next = node->next;
+    } else {
+        _front = node->next;
+    }
+    if(node->next) {
+        node->next->prev = node->prev;
+    } else {
+        _back = node->prev;
+    }
+    node->prev.reset();
+    node->next.reset();
+}
+
+/*
+ * Keeps the last inserted node in the list, the insertion starts from it.
+ * The removed node before it shifts its position.
+ */
+template<typename Num>
+void sorted_list<Num>::release_last_node(const node_ptr& node, bool before) noexcept
+{
+    if(node == last_node) {
+        if(node->next) {
+            last_node = node->next;
+        } else {
+            last_node = node->prev;
+            last_pos = last_pos ? last_pos - 1 : 0;
+        }
+    } else if(before && last_pos) {
+        last_pos--;
+    }
+}
+
+/*
+ * Inserts a new element and returns its node.
+ * The first and the last positions are checked at once, other positions are searched from the last inserted node:
+ * to the beginning of the list, while the element is before the node, then to the end of the list,
+ * while the element is after the next node.
+ */
+template<typename Num>
+typename sorted_list<Num>::node_ptr sorted_list<Num>::insert_node(Num&& element, bool with_pos)
+{
+    node_ptr node;
+    unsigned int pos = 0;
+    bool known = true;
+    if(_empty) {
+        node = _front = _back = make_shared_ptr<Node>(std::forward<Num>(element), nullptr, nullptr);
+        _empty = false;
+    } else if(in_order(element, _front->value)) {
+        node = create_new_node(nullptr, std::forward<Num>(element), index::FIRST);
+    } else if(in_order(_back->value, element)) {
+        node = create_new_node(nullptr, std::forward<Num>(element), index::LAST);
+        pos = _count;
+    } else {
+        if(!last_node) {
+            set_last_node(_front, 0);
+            last_pos_known = true;
+        }
+        if(!last_pos_known) {
+            if(with_pos) {
+                // Recounts the position of the last inserted node.
+                last_pos = 0;
+                for(node_ptr t = _front; t != last_node; t = t->next) {
+                    last_pos++;
+                }
+                last_pos_known = true;
+            } else {
+                known = false;
+            }
+        }
+        node_ptr head = last_node;
+        pos = last_pos;
+        while(head->prev && !in_order(head->value, element)) {
+            head = head->prev;
+            --pos;
+        }
+        while(head->next && !in_order(element, head->next->value)) {
+            head = head->next;
+            ++pos;
+        }
+        // A new element is inserted after `head`.
+        node = create_new_node(head, std::forward<Num>(element), head->next ? index::MIDDLE : index::LAST);
+        ++pos;
     }
     _count++;
+    set_last_node(node, pos);
+    last_pos_known = known;
+    return node;
 }
 
 /*
@@ -677,6 +906,7 @@ Num sorted_list<Num>::pop_back() noexcept
     if(!_empty) {
         Num value;
         node_ptr old = _back;
+        release_last_node(old, false);
         if(_back == _front) {
             if(_back) {
                 value = _back->value; // gets the value of the last element.
@@ -710,6 +940,7 @@ Num sorted_list<Num>::pop_front() noexcept
     if(!_empty) {
         Num value;
         node_ptr old = _front;
+        release_last_node(old, true);
         if(_front == _back) {
             if(_front) {
                 value = _back->value; // Gets the value of the last element.
@@ -746,6 +977,7 @@ Num sorted_list<Num>::remove(int pos)
     if(is_out_of_range(pos)) {
         throw std::out_of_range("Error: list index out of range.");
     }
+    const bool before = static_cast<unsigned int>(pos) < last_pos;
     node_ptr head = _front;
     // Gets element from the position.
     while(head && pos--) {
@@ -754,6 +986,7 @@ Num sorted_list<Num>::remove(int pos)
     if(!head) {
         throw std::out_of_range("Error: list index out of range.");
     }
+    release_last_node(head, before);
     node_ptr old = head;
     // Gets a value from the node.
     Num value = head->value;
@@ -773,6 +1006,7 @@ Num sorted_list<Num>::remove(int pos)
     }
     old.reset();
     _count--;
+    _empty = _count == 0;
     return value;
 }
 
@@ -804,22 +1038,15 @@ template<typename Num>
 void sorted_list<Num>::reverse() noexcept
 {
     if(!_empty) {
-        node_ptr t = _back, old = _back;
-        // Sets the previous element.
-        t = t->prev;
-
-	// Creates the first element from the last element.
-	_front = _back = make_shared_ptr<Node>(std::move(_back->value), nullptr, nullptr);
-	while(t) {
-	    node_ptr new_node = make_shared_ptr<Node>(std::move(t->value), nullptr, _back);
-	    old = t;
-	    _back->next = new_node;
-	    // Sets the last element.
-	    _back = new_node;
-	    t = t->prev;
-	    // reset left element
-	    old->next.reset();
-	}
+        // Swaps the pointers of each node, the nodes stay in memory,
+        // so the handles to the elements stay valid.
+        node_ptr t = _front;
+        while(t) {
+            std::swap(t->next, t->prev);
+            t = t->prev;
+        }
+        std::swap(_front, _back);
+        last_pos = last_pos < _count ? _count - 1 - last_pos : 0;
     }
     reversed = !reversed;
 }
@@ -830,6 +1057,7 @@ void sorted_list<Num>::reverse() noexcept
 template<typename Num>
 void sorted_list<Num>::assign(node_ptr front)
 {
+    last_node = nullptr, last_pos = 0, last_pos_known = true;
     if(!_empty) {
         _front = _back = make_shared_ptr<Node>(front->value, nullptr, nullptr); // creates a new pointer.
         node_ptr t = front->next;                                               // gets a pointer to the next element.
@@ -839,6 +1067,7 @@ void sorted_list<Num>::assign(node_ptr front)
             _back = new_node;
             t = t->next;
 	}
+	last_node = _front;
     }
 }
 
@@ -858,7 +1087,8 @@ void sorted_list<Num>::clear() noexcept
     _front = _back = nullptr;
     _count = 0;
     _empty = true, reversed = false;
-    last_pos = 0, last_node = nullptr;
+    last_pos = 0, last_node = nullptr, last_pos_known = true;
+    history.clear();
 }
 
 /*
@@ -899,6 +1129,118 @@ Num sorted_list<Num>::operator[](int pos) const noexcept
     return pos <= 0 ? head->value : Num();
 }
 
+/*
+ * The `quantile` function.
+ * Returns the element from the position of the quantile.
+ * Goes from the nearest end of the list.
+ */
+template<typename Num>
+Num sorted_list<Num>::quantile(double q) const
+{
+    unsigned int pos = quantile_pos(q);
+    node_ptr head;
+    if(pos < _count / 2) {
+        head = _front;
+        while(pos--) {
+            head = head->next;
+        }
+    } else {
+        head = _back;
+        for(unsigned int i = _count - 1; i > pos; i--) {
+            head = head->prev;
+        }
+    }
+    return head->value;
+}
+
+/*
+ * The `quantiles` function.
+ * Sorts the positions of the quantiles and gets all the elements
+ * for one pass through the list.
+ */
+template<typename Num>
+std::vector<Num> sorted_list<Num>::quantiles(const std::vector<double>& qs) const
+{
+    // Pairs: the position in the list, the index of the quantile.
+    std::vector<std::pair<unsigned int, std::size_t>> positions;
+    positions.reserve(qs.size());
+    for(std::size_t i = 0; i < qs.size(); i++) {
+        positions.emplace_back(quantile_pos(qs[i]), i);
+    }
+    std::sort(positions.begin(), positions.end());
+
+    std::vector<Num> result(qs.size());
+    node_ptr head = _front;
+    unsigned int pos = 0;
+    for(const auto& p : positions) {
+        while(pos < p.first) {
+            head = head->next;
+            ++pos;
+        }
+        result[p.second] = head->value;
+    }
+    return result;
+}
+
+/*
+ * Sets the size of the sliding window.
+ * Removes the oldest elements, if the list is bigger than a new window.
+ */
+template<typename Num>
+void sorted_list<Num>::set_window(unsigned int size)
+{
+    if(size && !_window) {
+        // The order of insertion is unknown, so the elements are expired in the order of the list.
+        history.clear();
+        for(node_ptr head = _front; head; head = head->next) {
+            history.emplace_back(head);
+        }
+    } else if(!size) {
+        history.clear();
+    }
+    _window = size;
+    expire();
+}
+
+/*
+ * Returns the position of the quantile.
+ * Uses the nearest rank: `q * (count - 1)`, rounded to the nearest integer.
+ */
+template<typename Num>
+unsigned int sorted_list<Num>::quantile_pos(double q) const
+{
+    if(_empty || !(q >= 0.0 && q <= 1.0)) {
+        throw std::out_of_range("Error: quantile out of range.");
+    }
+    auto pos = static_cast<unsigned int>(q * static_cast<double>(_count - 1) + 0.5);
+    // The first element of the reversed list is the maximum element.
+    return reversed ? _count - 1 - pos : pos;
+}
+
+/*
+ * Removes the oldest elements from the window.
+ * Skips the elements, which were already removed from the list.
+ * If the window is not set, the history is empty.
+ */
+template<typename Num>
+void sorted_list<Num>::expire()
+{
+    while(_count > _window && !history.empty()) {
+        node_ptr oldest = history.front().lock();
+        history.pop_front();
+        if(is_linked(oldest)) {
+            erase(handle(oldest));
+        }
+    }
+    // Drops the elements, which were removed by other functions.
+    if(history.size() > 2 * static_cast<std::size_t>(_window)) {
+        history.erase(std::remove_if(history.begin(),
+                                     history.end(),
+                                     [this](const std::weak_ptr<Node>& n) { return !is_linked(n.lock()); }),
+                      history.end());
+    }
+}
+
 /*
  * Constructor.
  */
@@ -928,4 +1270,95 @@ std::ostream& operator<<(std::ostream& stream, const sorted_list<T>& list)
 
 #endif /* __cplusplus */
 
+#include <stddef.h>
+
+/*
+ * A declaration the structure `c_sorted_list` for C.
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+    namespace pure_c
+    {
+    /**
+     * The structure `c_sorted_list`.
+     * The sorted list of the elements of the same size, which is implemented by the `sorted_list` class.
+     * The elements are copied into the nodes of the list and compared by the function of the user.
+     */
+    typedef struct c_sorted_list c_sorted_list;
+    /**
+     * Creates a new list.
+     * @param element_size the size of each element, from `1` to `256` bytes.
+     * @param compare the comparison function: negative if the first element is less, `0` if the elements are equal,
+     * otherwise positive. If it is `NULL`, the bytes are compared by `memcmp`.
+     * @return a new list, `NULL` if the size is wrong.
+     */
+    c_sorted_list* c_sorted_list_create(size_t element_size, int (*compare)(const void*, const void*));
+    /**
+     * Inserts a copy of the element into the list.
+     * @param l a pointer to the list.
+     * @param element a pointer to the element.
+     */
+    void c_sorted_list_push(c_sorted_list* l, const void* element);
+    /**
+     * Inserts the array of the elements into the list.
+     * The elements are sorted before, so each element is inserted near the previous one.
+     * @param l a pointer to the list.
+     * @param elements a pointer to the contiguous array of the elements.
+     * @param n the number of the elements.
+     */
+    void c_sorted_list_push_n(c_sorted_list* l, const void* elements, size_t n);
+    /**
+     * Removes the first (minimum) element and copies it into the buffer.
+     * @param l a pointer to the list.
+     * @param buffer a pointer to the memory for the element, can be `NULL`.
+     * @return `1` if the element is removed, `0` if the list is empty.
+     */
+    int c_sorted_list_pop_front(c_sorted_list* l, void* buffer);
+    /**
+     * Removes the last (maximum) element and copies it into the buffer.
+     * @param l a pointer to the list.
+     * @param buffer a pointer to the memory for the element, can be `NULL`.
+     * @return `1` if the element is removed, `0` if the list is empty.
+     */
+    int c_sorted_list_pop_back(c_sorted_list* l, void* buffer);
+    /**
+     * Removes the element from the position and copies it into the buffer.
+     * @param l a pointer to the list.
+     * @param pos the position of the element.
+     * @param buffer a pointer to the memory for the element, can be `NULL`.
+     * @return `1` if the element is removed, `0` if the position is out of range.
+     */
+    int c_sorted_list_remove(c_sorted_list* l, size_t pos, void* buffer);
+    /**
+     * Copies the element from the position into the buffer.
+     * @param l a pointer to the list.
+     * @param pos the position of the element.
+     * @param buffer a pointer to the memory for the element.
+     * @return `1` if the element is copied, `0` if the position is out of range.
+     */
+    int c_sorted_list_at(const c_sorted_list* l, size_t pos, void* buffer);
+    /**
+     * Returns the number of elements.
+     * @param l a pointer to the list.
+     * @return the number of elements.
+     */
+    size_t c_sorted_list_count(const c_sorted_list* l);
+    /**
+     * Removes all the elements from the list.
+     * @param l a pointer to the list.
+     */
+    void c_sorted_list_clear(c_sorted_list* l);
+    /**
+     * Removes the list from memory.
+     * @param l a pointer to the list.
+     */
+    void c_sorted_list_delete(c_sorted_list* l);
+    } // namespace pure_c
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* SORTED_LIST_H */
@@ -0,0 +1,398 @@
+/**
+ * @file space_saving.h
+ *
+ * Contains the class `SpaceSaving`.
+ */
+#ifndef SPACE_SAVING_H
+#define SPACE_SAVING_H
+
+#ifdef __cplusplus
+#include "flat_map.h"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * This class counts approximately the most common elements of a sequence
+ * using the Space-Saving algorithm. Only `capacity` elements are monitored,
+ * so the memory does not depend on the number of different elements.
+ * The counts are stored in the Stream-Summary structure: the list of buckets
+ * sorted by count, each bucket contains the elements with the same count,
+ * so an increment costs a constant time.
+ *
+ * Guarantees: for each monitored element `count(e) - error(e) <= the real count <= count(e)`,
+ * and each element, which real count is more than `total() / capacity()`, is monitored.
+ * @tparam T type of the sequence.
+ * @tparam SortFirst sort by first element or not, if the numbers are equal.
+ * @tparam Map type of the map, which finds the monitored elements.
+ */
+template<typename T, bool SortFirst = true, typename Map = FlatMap<T, std::size_t>>
+class SpaceSaving
+{
+  public:
+    /**
+     * Pair type: first - the element from a some sequence, second - the estimated number of such elements.
+     */
+    using pair_t = std::pair<T, unsigned int>;
+    /**
+     * Vector type. Contains `pair_t` pairs.
+     */
+    using vector_t = std::vector<pair_t>;
+
+  public:
+    /**
+     * Constructor.
+     * If the capacity is `0`, throws the `invalid_argument` exception.
+     * @param capacity the maximum number of monitored elements.
+     */
+    explicit SpaceSaving(std::size_t capacity);
+    /**
+     * Constructor, counts the elements of the sequence.
+     * @param capacity the maximum number of monitored elements.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    SpaceSaving(std::size_t capacity, IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Destructor.
+     */
+    virtual ~SpaceSaving() = default;
+    /**
+     * Counts new elements.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    void update(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Counts a new element.
+     * If all the slots are used, replaces the element with the minimum count.
+     * @param element a new element.
+     */
+    void push(const T& element);
+    /**
+     * Returns the vector of pairs, sorted by the greater estimated number of elements.
+     * The same as `Counter::most_common`.
+     * @param n the number of the first elements, by default is -1 (all the monitored elements).
+     * @return the vector of pairs.
+     */
+    vector_t most_common(int n = -1) const;
+    /**
+     * Returns the estimated number of the element, an upper bound of the real number.
+     * @param element an element.
+     * @return the estimated number, `0` if the element is not monitored.
+     */
+    unsigned int count(const T& element) const;
+    /**
+     * Returns the maximum overestimation of the number of the element.
+     * The real number is in the range `[count(element) - error(element), count(element)]`.
+     * @param element an element.
+     * @return the error, `0` if the element is not monitored.
+     */
+    unsigned int error(const T& element) const;
+    /**
+     * @return the number of counted elements, including repeated elements.
+     */
+    inline unsigned long total() const noexcept { return _total; }
+    /**
+     * @return the number of monitored elements.
+     */
+    inline std::size_t size() const noexcept { return _size; }
+    /**
+     * @return the maximum number of monitored elements.
+     */
+    inline std::size_t capacity() const noexcept { return _entries.size(); }
+
+  private:
+    /**
+     * The index of nothing.
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    /**
+     * The monitored element.
+     */
+    struct Entry
+    {
+        T value{};                //! the element.
+        unsigned int error{0};   //! the maximum overestimation.
+        std::size_t bucket{npos}; //! the bucket of the element.
+        std::size_t prev{npos};   //! the previous element in the bucket.
+        std::size_t next{npos};   //! the next element in the bucket.
+    };
+    /**
+     * The bucket of the elements with the same count.
+     */
+    struct Bucket
+    {
+        unsigned int count{0};   //! the count of the elements.
+        std::size_t first{npos}; //! the first element in the bucket.
+        std::size_t prev{npos};  //! the bucket with the lower count.
+        std::size_t next{npos};  //! the bucket with the greater count, or the next free bucket.
+    };
+    /**
+     * Increments the count of the element.
+     * Moves the element to the next bucket.
+     */
+    void increment(std::size_t e);
+    /**
+     * Adds the element to the bucket.
+     */
+    void attach(std::size_t e, std::size_t b) noexcept;
+    /**
+     * Removes the element from its bucket.
+     * If the bucket is empty, frees the bucket.
+     */
+    void detach(std::size_t e) noexcept;
+    /**
+     * Returns a new bucket with the count. Inserts it after the bucket `after`
+     * (before the first bucket if `after` is `npos`).
+     */
+    std::size_t new_bucket(unsigned int count, std::size_t after) noexcept;
+    /**
+     * Compares two pair
+     */
+    constexpr static inline bool sort_pair(const pair_t& a, const pair_t& b) noexcept
+    {
+        return SortFirst && a.second == b.second ? a.first < b.first : a.second > b.second;
+    }
+
+  private:
+    std::vector<Entry> _entries;  //! the monitored elements.
+    std::vector<Bucket> _buckets; //! the buckets.
+    Map _index;                   //! element -> index of the entry.
+    std::size_t _size{0};         //! the number of monitored elements.
+    std::size_t _min{npos};       //! the bucket with the minimum count.
+    std::size_t _max{npos};       //! the bucket with the maximum count.
+    std::size_t _free{0};         //! the first free bucket.
+    unsigned long _total{0};      //! the number of counted elements.
+};
+
+/*
+ * Constructor.
+ * Each monitored element needs at most one bucket.
+ */
+template<typename T, bool SortFirst, typename Map>
+SpaceSaving<T, SortFirst, Map>::SpaceSaving(std::size_t capacity) : _entries(capacity), _buckets(capacity), _index()
+{
+    if(!capacity) {
+        throw std::invalid_argument("Error: capacity must be more than 0.");
+    }
+    // The free buckets are linked by the `next` index.
+    for(std::size_t i = 0; i + 1 < capacity; i++) {
+        _buckets[i].next = i + 1;
+    }
+}
+
+/*
+ * Constructor.
+ * Counts the elements of the sequence.
+ */
+template<typename T, bool SortFirst, typename Map>
+template<typename IteratorBegin, typename IteratorEnd>
+SpaceSaving<T, SortFirst, Map>::SpaceSaving(std::size_t capacity, IteratorBegin _begin, IteratorEnd _end) :
+    SpaceSaving(capacity)
+{
+    update(_begin, _end);
+}
+
+/*
+ * The `update` function.
+ */
+template<typename T, bool SortFirst, typename Map>
+template<typename IteratorBegin, typename IteratorEnd>
+void SpaceSaving<T, SortFirst, Map>::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    for(auto it = _begin; it != _end; it++) {
+        push(*it);
+    }
+}
+
+/*
+ * The `push` function.
+ * 1) The element is monitored - increments its count.
+ * 2) There is a free slot - monitors the element with the count `1`.
+ * 3) Otherwise replaces the element with the minimum count `min`,
+ *    the new element gets the count `min + 1` and the error `min`.
+ */
+template<typename T, bool SortFirst, typename Map>
+void SpaceSaving<T, SortFirst, Map>::push(const T& element)
+{
+    ++_total;
+    auto it = _index.find(element);
+    if(it != _index.end()) {
+        increment(it->second);
+        return;
+    }
+    if(_size < _entries.size()) {
+        std::size_t e = _size++;
+        _entries[e].value = element;
+        _entries[e].error = 0;
+        std::size_t b = (_min != npos && _buckets[_min].count == 1) ? _min : new_bucket(1, npos);
+        attach(e, b);
+        _index[element] = e;
+        return;
+    }
+    std::size_t e = _buckets[_min].first;
+    _index.erase(_entries[e].value);
+    _entries[e].value = element;
+    _entries[e].error = _buckets[_min].count;
+    _index[element] = e;
+    increment(e);
+}
+
+/*
+ * The `most_common` function.
+ * Goes from the bucket with the maximum count, takes the whole buckets,
+ * so the elements with the same count are sorted like in the `Counter` class.
+ */
+template<typename T, bool SortFirst, typename Map>
+typename SpaceSaving<T, SortFirst, Map>::vector_t SpaceSaving<T, SortFirst, Map>::most_common(int n) const
+{
+    std::size_t number = _size;
+    if(n != -1 && static_cast<std::size_t>(n) <= _size) {
+        number = static_cast<std::size_t>(n);
+    }
+    vector_t result;
+    result.reserve(number);
+    for(std::size_t b = _max; b != npos && result.size() < number; b = _buckets[b].prev) {
+        for(std::size_t e = _buckets[b].first; e != npos; e = _entries[e].next) {
+            result.emplace_back(_entries[e].value, _buckets[b].count);
+        }
+    }
+    std::sort(result.begin(), result.end(), sort_pair);
+    result.erase(result.begin() + static_cast<std::ptrdiff_t>(number), result.end());
+    return result;
+}
+
+/*
+ * Returns the estimated number of the element.
+ */
+template<typename T, bool SortFirst, typename Map>
+unsigned int SpaceSaving<T, SortFirst, Map>::count(const T& element) const
+{
+    auto it = _index.find(element);
+    return it != _index.end() ? _buckets[_entries[it->second].bucket].count : 0;
+}
+
+/*
+ * Returns the maximum overestimation of the number of the element.
+ */
+template<typename T, bool SortFirst, typename Map>
+unsigned int SpaceSaving<T, SortFirst, Map>::error(const T& element) const
+{
+    auto it = _index.find(element);
+    return it != _index.end() ? _entries[it->second].error : 0;
+}
+
+/*
+ * Increments the count of the element.
+ * If the element is alone in its bucket and the next bucket has another count,
+ * just increments the count of the bucket.
+ */
+template<typename T, bool SortFirst, typename Map>
+void SpaceSaving<T, SortFirst, Map>::increment(std::size_t e)
+{
+    std::size_t b = _entries[e].bucket;
+    unsigned int count = _buckets[b].count + 1;
+    std::size_t next = _buckets[b].next;
+    if(next != npos && _buckets[next].count == count) {
+        detach(e);
+        attach(e, next);
+    } else if(_buckets[b].first == e && _entries[e].next == npos) {
+        _buckets[b].count = count;
+    } else {
+        std::size_t nb = new_bucket(count, b);
+        detach(e);
+        attach(e, nb);
+    }
+}
+
+/*
+ * Adds the element to the beginning of the bucket.
+ */
+template<typename T, bool SortFirst, typename Map>
+void SpaceSaving<T, SortFirst, Map>::attach(std::size_t e, std::size_t b) noexcept
+{
+    Entry& entry = _entries[e];
+    entry.bucket = b;
+    entry.prev = npos;
+    entry.next = _buckets[b].first;
+    if(entry.next != npos) {
+        _entries[entry.next].prev = e;
+    }
+    _buckets[b].first = e;
+}
+
+/*
+ * Removes the element from its bucket.
+ * The empty bucket is removed from the list and added to the free buckets.
+ */
+template<typename T, bool SortFirst, typename Map>
+void SpaceSaving<T, SortFirst, Map>::detach(std::size_t e) noexcept
+{
+    Entry& entry = _entries[e];
+    std::size_t b = entry.bucket;
+    if(entry.prev != npos) {
+        _entries[entry.prev].next = entry.next;
+    } else {
+        _buckets[b].first = entry.next;
+    }
+    if(entry.next != npos) {
+        _entries[entry.next].prev = entry.prev;
+    }
+    entry.bucket = entry.prev = entry.next = npos;
+
+    Bucket& bucket = _buckets[b];
+    if(bucket.first != npos) {
+        return;
+    }
+    if(bucket.prev != npos) {
+        _buckets[bucket.prev].next = bucket.next;
+    } else {
+        _min = bucket.next;
+    }
+    if(bucket.next != npos) {
+        _buckets[bucket.next].prev = bucket.prev;
+    } else {
+        _max = bucket.prev;
+    }
+    bucket.prev = npos;
+    bucket.next = _free;
+    _free = b;
+}
+
+/*
+ * Returns a new bucket from the free buckets.
+ * There are always free buckets: each used bucket contains at least one element,
+ * and a new bucket is needed only when an element leaves its bucket.
+ */
+template<typename T, bool SortFirst, typename Map>
+std::size_t SpaceSaving<T, SortFirst, Map>::new_bucket(unsigned int count, std::size_t after) noexcept
+{
+    std::size_t b = _free;
+    _free = _buckets[b].next;
+
+    Bucket& bucket = _buckets[b];
+    bucket.count = count;
+    bucket.first = npos;
+    bucket.prev = after;
+    bucket.next = after != npos ? _buckets[after].next : _min;
+    if(bucket.next != npos) {
+        _buckets[bucket.next].prev = b;
+    } else {
+        _max = b;
+    }
+    if(after != npos) {
+        _buckets[after].next = b;
+    } else {
+        _min = b;
+    }
+    return b;
+}
+
+#endif /* __cplusplus */
+
+#endif /* SPACE_SAVING_H */
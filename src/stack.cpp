@@ -12,9 +12,40 @@ stack* stack_create()
     s->front = NULL;
     s->empty = 1;
     s->count = 0;
+    s->_pool = NULL;
     return s;
 }
 
+/*
+ * Creates a stack with the pool of nodes and returns a pointer to it.
+ */
+stack* stack_create_with_pool()
+{
+    stack* s = stack_create();
+    s->_pool = pool_create();
+    return s;
+}
+
+/*
+ * Allocates a node with the value.
+ */
+static inline stack_node* stack_alloc_node(stack* s, size_t size)
+{
+    return (stack_node*)(s->_pool ? pool_alloc(s->_pool, size) : std::malloc(size));
+}
+
+/*
+ * Releases a node.
+ */
+static inline void stack_free_node(stack* s, stack_node* node)
+{
+    if(s->_pool) {
+        pool_free(s->_pool, node, pure_c::inline_value_offset(sizeof(stack_node)) + node->_aligned);
+    } else {
+        free(node);
+    }
+}
+
 /*
  * Removes the stack and all the elements from memory.
  */
@@ -23,8 +54,10 @@ void stack_delete(stack* s)
     while(s->front) {
         stack_node* old = s->front;
         s->front = s->front->prev;
-        free(old->value);
-        free(old);
+        stack_free_node(s, old);
+    }
+    if(s->_pool) {
+        pool_delete(s->_pool);
     }
     free(s);
 }
@@ -32,12 +65,15 @@ void stack_delete(stack* s)
 /*
  * Inserts a new element into the stack.
  * Increases the size of the stack.
+ * The node and the value are allocated in one memory block.
  */
 void stack_push(stack* s, const void* element, size_t length)
 {
-    stack_node* new_node = (stack_node*)std::malloc(sizeof(stack_node)); // a new node.
+    const size_t offset = pure_c::inline_value_offset(sizeof(stack_node));
+    stack_node* new_node = stack_alloc_node(s, offset + length); // a new node with the value.
     new_node->prev = NULL;
-    new_node->value = pure_c::copy_memory_block(element, length); // copies a value.
+    new_node->value = (char*)new_node + offset;
+    std::memcpy(new_node->value, element, length); // copies a value.
     new_node->_aligned = length;
     if(s->empty) {
         s->front = new_node;
@@ -50,22 +86,109 @@ void stack_push(stack* s, const void* element, size_t length)
 }
 
 /*
- * Removes the last element from the stack and returns the deleted element.
+ * Inserts the elements of the different lengths into the stack, the last element becomes the first.
+ * The nodes are linked into a chain, which is attached before the first node at once.
+ */
+size_t stack_push_batch(stack* s, const void* const* elements, const size_t* lengths, size_t n)
+{
+    if(!n) {
+        return 0;
+    }
+    const size_t offset = pure_c::inline_value_offset(sizeof(stack_node));
+    stack_node* top = s->front;
+    for(size_t i = 0; i < n; i++) {
+        stack_node* new_node = stack_alloc_node(s, offset + lengths[i]); // a new node with the value.
+        new_node->prev = top;
+        new_node->value = (char*)new_node + offset;
+        std::memcpy(new_node->value, elements[i], lengths[i]);
+        new_node->_aligned = lengths[i];
+        top = new_node;
+    }
+    s->front = top;
+    s->count += (unsigned int)n;
+    s->empty = 0;
+    return n;
+}
+
+/*
+ * Removes the first elements from the stack and copies them into the buffers.
+ * The nodes are released one by one, the first node and the size of the stack are changed once.
+ */
+size_t stack_pop_batch(stack* s, void* const* buffers, const size_t* capacities, size_t* lengths, size_t n)
+{
+    size_t removed = 0;
+    stack_node* node = s->front;
+    while(removed < n && node != NULL && node->_aligned <= capacities[removed]) {
+        stack_node* prev = node->prev;
+        std::memcpy(buffers[removed], node->value, node->_aligned);
+        if(lengths) {
+            lengths[removed] = node->_aligned;
+        }
+        stack_free_node(s, node);
+        node = prev;
+        removed++;
+    }
+    s->front = node;
+    s->count -= (unsigned int)removed;
+    s->empty = s->count == 0 ? 1 : 0;
+    return removed;
+}
+
+/*
+ * Unlinks the first node from the stack.
  * Reduces the size of the stack.
  */
+static stack_node* stack_unlink_front(stack* s)
+{
+    stack_node* temp = s->front;
+    s->front = s->front->prev;
+    s->count--;
+    s->empty = s->count == 0 ? 1 : 0;
+    return temp;
+}
+
+/*
+ * Removes the last element from the stack and returns the deleted element.
+ * The node is given to the caller: the value is moved to the beginning of the node.
+ */
 void* stack_pop(stack* s)
 {
-    void* value = NULL;
-    if(!s->empty) {
-        stack_node* temp = s->front;
-        value = pure_c::copy_memory_block(s->front->value, s->front->_aligned); // gets a value from the element.
-        s->front = s->front->prev;
-        free(temp->value);
-        free(temp);
-        s->count--;
+    if(s->empty) {
+        return NULL;
     }
-    s->empty = s->count == 0 ? 1 : 0;
-    return value;
+    stack_node* temp = stack_unlink_front(s);
+    if(s->_pool) {
+        void* value = pure_c::copy_memory_block(temp->value, temp->_aligned);
+        stack_free_node(s, temp);
+        return value;
+    }
+    std::memmove(temp, temp->value, temp->_aligned);
+    return temp;
+}
+
+/*
+ * Removes the last element from the stack and copies it into the buffer.
+ */
+size_t stack_pop_into(stack* s, void* buffer, size_t capacity)
+{
+    if(s->empty) {
+        return 0;
+    }
+    size_t length = s->front->_aligned;
+    if(length <= capacity) {
+        stack_node* temp = stack_unlink_front(s);
+        std::memcpy(buffer, temp->value, length);
+        stack_free_node(s, temp);
+    }
+    return length;
+}
+
+/*
+ * Returns the first element of the stack without copying.
+ */
+const void* stack_peek_front(const stack* s)
+{
+    return s->front != NULL ? s->front->value : NULL;
 }
 
 /*
@@ -80,6 +203,16 @@ void* stack_front(stack* s)
     return value;
 }
 
+/*
+ * Releases the idle slabs of the pool.
+ */
+void stack_shrink_to_fit(stack* s)
+{
+    if(s->_pool) {
+        pool_shrink(s->_pool);
+    }
+}
+
 /*
  * Returns the size of the stack.
  */
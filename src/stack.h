@@ -434,6 +434,8 @@ Stack<Type>::iterator::iterator(node_ptr node) : _node(node)
 
 #endif /* __cplusplus */
 
+#include "pool.h"
+
 /*
  * A declaration the structure `stack` for C.
  */
@@ -449,7 +451,7 @@ extern "C"
     typedef struct stack_node
     {
         size_t _aligned;  //! length of a type
-        void* value;      //! a pointer to a value.
+        void* value;      //! a pointer to the value, which is stored in the same memory block after the node.
         stack_node* prev; //! a pointer to the next node.
     } stack_node;
     /**
@@ -461,12 +463,25 @@ extern "C"
         stack_node* front;  //! a pointer to the first node.
 	unsigned int count; //! a pointer to the last node.
 	int empty;
+	pool* _pool;        //! the pool of nodes, `NULL` - the nodes are allocated by `malloc`.
     } stack;
     /**
      * The `stack_create_stack` function.
      * @return a new stack.
      */
     stack* stack_create();
+    /**
+     * Creates a new stack, which allocates the nodes from its own pool.
+     * The released nodes are reused, so the stack in the steady state does not call `malloc` and `free`.
+     * `stack_pop` of this stack copies the element, use `stack_pop_into` to avoid the allocation.
+     * @return a new stack.
+     */
+    stack* stack_create_with_pool(void);
+    /**
+     * Releases the memory, which is not used by the elements: the idle slabs of the pool.
+     * @param s a pointer to the stack.
+     */
+    void stack_shrink_to_fit(stack* s);
     /**
      * Inserts a new element into the stack.
      * @param s a pointer to the stack.
@@ -476,12 +491,52 @@ extern "C"
     void stack_push(stack* s, const void* element, size_t length = sizeof(void*));
     /**
      * Removes the first element from the stack.
-     * Returns a pointer to the deleted element.
+     * Returns a pointer to the deleted element, the memory of the element must be released by `free`.
+     * The element is moved to the beginning of its node, so the memory is not allocated.
      * If the stack is empty, returns the `NULL` pointer.
      * @param s a pointer to the stack.
      * @return the deleted element.
      */
     void* stack_pop(stack* s);
+    /**
+     * Removes the first element from the stack and copies it into the buffer.
+     * If the buffer is less than the element, the element is not removed.
+     * @param s a pointer to the stack.
+     * @param buffer a pointer to the memory for the element.
+     * @param capacity the size of the buffer.
+     * @return the length of the element, `0` if the stack is empty.
+     * If the result is more than the capacity, the element was not copied.
+     */
+    size_t stack_pop_into(stack* s, void* buffer, size_t capacity);
+    /**
+     * Inserts several elements of the different lengths into the stack, the last element becomes the first.
+     * The nodes are linked together and attached to the stack at once.
+     * @param s a pointer to the stack.
+     * @param elements the array of `n` pointers to the elements.
+     * @param lengths the array of `n` lengths of the elements.
+     * @param n the number of elements.
+     * @return the number of inserted elements.
+     */
+    size_t stack_push_batch(stack* s, const void* const* elements, const size_t* lengths, size_t n);
+    /**
+     * Removes several first elements from the stack and copies them into the buffers, one element into one buffer.
+     * Stops, if the stack is empty or the buffer is less than the element, this element is not removed.
+     * @param s a pointer to the stack.
+     * @param buffers the array of `n` pointers to the memory for the elements.
+     * @param capacities the array of `n` sizes of the buffers.
+     * @param lengths the array of `n` lengths of the removed elements, can be `NULL`.
+     * @param n the maximum number of elements.
+     * @return the number of removed elements.
+     */
+    size_t stack_pop_batch(stack* s, void* const* buffers, const size_t* capacities, size_t* lengths, size_t n);
+    /**
+     * Returns a pointer to the first element, which is stored in the stack.
+     * The element is not copied: the pointer is valid while the element is in the stack.
+     * If the stack is empty, returns the `NULL` pointer.
+     * @param s a pointer to the stack.
+     * @return the first element.
+     */
+    const void* stack_peek_front(const stack* s);
     /**
      * Returns a pointer to the first element of the stack.
      * If the stack is empty, returns the `NULL` pointer.
@@ -0,0 +1,284 @@
+/**
+ * @file static_hash_map.h
+ *
+ * Contains the class `StaticHashMap`.
+ */
+#ifndef STATIC_HASH_MAP_H
+#define STATIC_HASH_MAP_H
+
+#ifdef __cplusplus
+#include "staticarray.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * The hash function, which can be used at compile time.
+ * Implemented for the integral types, the enumerations and `std::string_view`.
+ * @tparam Key type of keys.
+ */
+template<typename Key, typename = void>
+struct StaticHash;
+
+namespace _helpers_static_hash
+{
+/**
+ * Mixes the bits of the hash.
+ * This is helper func. Do not use this.
+ */
+constexpr std::uint64_t mix(std::uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+} // namespace _helpers_static_hash
+
+/**
+ * The hash function for the integral types and the enumerations.
+ */
+template<typename Key>
+struct StaticHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>>
+{
+    /**
+     * @param key a key.
+     * @param seed a seed, the different seeds give the different hash functions.
+     * @return the hash.
+     */
+    constexpr std::uint64_t operator()(const Key& key, std::uint64_t seed) const noexcept
+    {
+        return _helpers_static_hash::mix(static_cast<std::uint64_t>(key) ^ (seed * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+/**
+ * The hash function for `std::string_view` (FNV-1a).
+ */
+template<>
+struct StaticHash<std::string_view>
+{
+    /**
+     * @param key a key.
+     * @param seed a seed, the different seeds give the different hash functions.
+     * @return the hash.
+     */
+    constexpr std::uint64_t operator()(std::string_view key, std::uint64_t seed) const noexcept
+    {
+        std::uint64_t h = 0xCBF29CE484222325ull ^ (seed * 0x9E3779B97F4A7C15ull);
+        for(char c : key) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001B3ull;
+        }
+        return _helpers_static_hash::mix(h);
+    }
+};
+
+/**
+ * The `StaticHashMap` class.
+ * This class is a map with the fixed keys, which is built at compile time.
+ * The map uses the perfect hashing (hash and displace): the keys are divided into the buckets
+ * by the first hash function, and each bucket has its own displacement, which chooses the second hash
+ * function without collisions. So a lookup costs two hashes and one comparison, without probing and heap.
+ * If the keys are not unique, the constructor throws the `invalid_argument` exception
+ * (at compile time this is a compile error).
+ * @tparam Key type of keys.
+ * @tparam Value type of values.
+ * @tparam Size number of keys.
+ * @tparam Hash hash function, which takes a key and a seed.
+ */
+template<typename Key, typename Value, std::size_t Size, typename Hash = StaticHash<Key>>
+class StaticHashMap
+{
+    static_assert(Size > 0, "Size must be more than 0.");
+
+  public:
+    /**
+     * Constructor.
+     * @code
+     * For example:
+     * constexpr StaticArray<std::string_view, 2> keys = {std::string_view("if"), std::string_view("else")};
+     * constexpr StaticArray<int, 2> values = {1, 2};
+     * constexpr StaticHashMap map(keys, values);
+     * @endcode
+     * @param keys the keys.
+     * @param values the values, the value of the key has the same position.
+     */
+    constexpr StaticHashMap(const StaticArray<Key, Size>& keys, const StaticArray<Value, Size>& values);
+    /**
+     * Returns the pointer to the value by the key.
+     * @param key a key.
+     * @return the pointer to the value, `nullptr` if the key does not exist.
+     */
+    constexpr const Value* find(const Key& key) const noexcept;
+    /**
+     * @param key a key.
+     * @return `true` if the key exists, otherwise `false`.
+     */
+    constexpr inline bool contains(const Key& key) const noexcept { return find(key) != nullptr; }
+    /**
+     * Returns the value by the key.
+     * If the key does not exist, throws the `out_of_range` exception.
+     * @param key a key.
+     * @return the value.
+     */
+    constexpr const Value& at(const Key& key) const;
+    /**
+     * Returns the position of the key in the array of keys.
+     * @param key a key.
+     * @return the position, `Size` if the key does not exist.
+     */
+    constexpr std::size_t index(const Key& key) const noexcept;
+    /**
+     * @return the number of keys.
+     */
+    constexpr inline std::size_t size() const noexcept { return Size; }
+
+  private:
+    /**
+     * The number of slots: the power of two, not less than the number of keys.
+     */
+    static constexpr std::size_t slots = [] {
+        std::size_t n = 1;
+        while(n < Size) {
+            n <<= 1;
+        }
+        return n;
+    }();
+    /**
+     * The number of buckets.
+     */
+    static constexpr std::size_t buckets = Size;
+    /**
+     * The maximum displacement.
+     */
+    static constexpr std::uint32_t max_displacement = 1u << 20;
+    /**
+     * @return the bucket of the key.
+     */
+    static constexpr inline std::size_t bucket(const Key& key) noexcept
+    {
+        return static_cast<std::size_t>(Hash{}(key, 0) % buckets);
+    }
+    /**
+     * @return the slot of the key with the displacement.
+     */
+    static constexpr inline std::size_t slot(const Key& key, std::uint32_t displacement) noexcept
+    {
+        return static_cast<std::size_t>(Hash{}(key, displacement + 1ull)) & (slots - 1);
+    }
+
+  private:
+    Key _keys[slots];                      //! the keys in their slots.
+    std::size_t _positions[slots];         //! the positions of the keys in the array of keys, `Size` - an empty slot.
+    Value _values[Size];                   //! the values.
+    std::uint32_t _displacements[buckets]; //! the displacements of the buckets.
+};
+
+/*
+ * Constructor.
+ * The buckets are placed from the largest bucket: all the keys of a bucket must
+ * get the free slots with the same displacement.
+ */
+template<typename Key, typename Value, std::size_t Size, typename Hash>
+constexpr StaticHashMap<Key, Value, Size, Hash>::StaticHashMap(const StaticArray<Key, Size>& keys,
+                                                              const StaticArray<Value, Size>& values) :
+    _keys{}, _positions{}, _values{}, _displacements{}
+{
+    std::size_t sizes[buckets]{};
+    for(std::size_t i = 0; i < Size; i++) {
+        _values[i] = values[i];
+        sizes[bucket(keys[i])]++;
+    }
+    for(std::size_t s = 0; s < slots; s++) {
+        _positions[s] = Size;
+    }
+    std::size_t largest = 0;
+    for(std::size_t b = 0; b < buckets; b++) {
+        largest = sizes[b] > largest ? sizes[b] : largest;
+    }
+    for(std::size_t n = largest; n > 0; n--) {
+        for(std::size_t b = 0; b < buckets; b++) {
+            if(sizes[b] != n) {
+                continue;
+            }
+            std::size_t members[Size]{};
+            std::size_t count = 0;
+            for(std::size_t i = 0; i < Size; i++) {
+                if(bucket(keys[i]) != b) {
+                    continue;
+                }
+                for(std::size_t m = 0; m < count; m++) {
+                    if(keys[members[m]] == keys[i]) {
+                        throw std::invalid_argument("Error: the keys are not unique.");
+                    }
+                }
+                members[count++] = i;
+            }
+            std::uint32_t d = 0;
+            for(; d < max_displacement; d++) {
+                bool free = true;
+                for(std::size_t m = 0; m < count && free; m++) {
+                    std::size_t s = slot(keys[members[m]], d);
+                    free = _positions[s] == Size;
+                    // The keys of the bucket must not collide with each other.
+                    for(std::size_t prev = 0; prev < m && free; prev++) {
+                        free = slot(keys[members[prev]], d) != s;
+                    }
+                }
+                if(free) {
+                    break;
+                }
+            }
+            if(d == max_displacement) {
+                throw std::invalid_argument("Error: cannot place the keys without collisions.");
+            }
+            _displacements[b] = d;
+            for(std::size_t m = 0; m < count; m++) {
+                std::size_t s = slot(keys[members[m]], d);
+                _keys[s] = keys[members[m]];
+                _positions[s] = members[m];
+            }
+        }
+    }
+}
+
+/*
+ * The `find` function.
+ */
+template<typename Key, typename Value, std::size_t Size, typename Hash>
+constexpr const Value* StaticHashMap<Key, Value, Size, Hash>::find(const Key& key) const noexcept
+{
+    std::size_t i = index(key);
+    return i != Size ? &_values[i] : nullptr;
+}
+
+/*
+ * The `at` function.
+ */
+template<typename Key, typename Value, std::size_t Size, typename Hash>
+constexpr const Value& StaticHashMap<Key, Value, Size, Hash>::at(const Key& key) const
+{
+    std::size_t i = index(key);
+    if(i == Size) {
+        throw std::out_of_range("Error: the key does not exist.");
+    }
+    return _values[i];
+}
+
+/*
+ * The `index` function.
+ */
+template<typename Key, typename Value, std::size_t Size, typename Hash>
+constexpr std::size_t StaticHashMap<Key, Value, Size, Hash>::index(const Key& key) const noexcept
+{
+    std::size_t s = slot(key, _displacements[bucket(key)]);
+    return _positions[s] != Size && _keys[s] == key ? _positions[s] : Size;
+}
+
+#endif /* __cplusplus */
+
+#endif /* STATIC_HASH_MAP_H */
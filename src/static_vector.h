@@ -0,0 +1,366 @@
+/**
+ * @file static_vector.h
+ *
+ * Contains the class `StaticVector`.
+ */
+#ifndef STATIC_VECTOR_H
+#define STATIC_VECTOR_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * The `StaticVector` class.
+ * This class a bit like `std::vector` with the fixed capacity. The elements are stored
+ * inside the object, in the uninitialized memory, so the vector never uses heap,
+ * and the elements are constructed only when they are added.
+ * Unlike `StaticArray`, the type of elements does not need a default constructor.
+ * @tparam T type of elements.
+ * @tparam N capacity of the vector.
+ */
+template<typename T, std::size_t N>
+class StaticVector
+{
+  public:
+    using value_type = T;           //! type of elements.
+    using size_type = std::size_t;  //! type of sizes.
+    using iterator = T*;            //! iterator.
+    using const_iterator = const T*; //! const iterator.
+
+  public:
+    /**
+     * Constructor.
+     * Creates an empty vector.
+     */
+    StaticVector() noexcept = default;
+    /**
+     * Constructor with the elements.
+     * If the number of elements is more than the capacity, throws the `length_error` exception.
+     * @param list the elements.
+     */
+    StaticVector(std::initializer_list<T> list);
+    /**
+     * Copy constructor.
+     */
+    StaticVector(const StaticVector& v);
+    /**
+     * Move constructor.
+     * Moves the elements one by one.
+     */
+    StaticVector(StaticVector&& v) noexcept(std::is_nothrow_move_constructible_v<T>);
+    /**
+     * Destructor.
+     * Destroys the elements.
+     */
+    ~StaticVector() { clear(); }
+    /**
+     * Copy assignment operator.
+     */
+    StaticVector& operator=(const StaticVector& v);
+    /**
+     * Move assignment operator.
+     */
+    StaticVector& operator=(StaticVector&& v) noexcept(std::is_nothrow_move_constructible_v<T>);
+    /**
+     * Adds the element to the end of the vector.
+     * If the vector is full, throws the `length_error` exception.
+     * @param value a value.
+     */
+    inline void push_back(const T& value) { emplace_back(value); }
+    /**
+     * Adds the element to the end of the vector.
+     * If the vector is full, throws the `length_error` exception.
+     * @param value a value.
+     */
+    inline void push_back(T&& value) { emplace_back(std::move(value)); }
+    /**
+     * Constructs the element at the end of the vector.
+     * If the vector is full, throws the `length_error` exception.
+     * @param args the arguments of the constructor of the element.
+     * @return the new element.
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+    /**
+     * Removes the last element.
+     * If the vector is empty, throws the `out_of_range` exception.
+     */
+    void pop_back();
+    /**
+     * Inserts the element before the position.
+     * If the vector is full, throws the `length_error` exception.
+     * @param pos the position.
+     * @param value a value.
+     * @return the iterator to the inserted element.
+     */
+    iterator insert(const_iterator pos, T value);
+    /**
+     * Removes the element from the position.
+     * @param pos the position.
+     * @return the iterator to the element after the removed element.
+     */
+    iterator erase(const_iterator pos);
+    /**
+     * Removes all the elements.
+     */
+    void clear() noexcept;
+    /**
+     * Returns the element from the position.
+     * If the position is out of range, throws the `out_of_range` exception.
+     * @param i index.
+     * @return the element.
+     */
+    T& at(size_type i);
+    /**
+     * The const version of the `at` function.
+     * @param i index.
+     * @return the element.
+     */
+    const T& at(size_type i) const;
+    /**
+     * The `operator[]`.
+     * This method will not check ranges!
+     * @param i index.
+     * @return the element.
+     */
+    inline T& operator[](size_type i) noexcept { return data()[i]; }
+    /**
+     * The const `operator[]`.
+     * This method will not check ranges!
+     * @param i index.
+     * @return the element.
+     */
+    inline const T& operator[](size_type i) const noexcept { return data()[i]; }
+    /**
+     * @return the first element. The vector must not be empty.
+     */
+    inline T& front() noexcept { return data()[0]; }
+    /**
+     * @return the first element. The vector must not be empty.
+     */
+    inline const T& front() const noexcept { return data()[0]; }
+    /**
+     * @return the last element. The vector must not be empty.
+     */
+    inline T& back() noexcept { return data()[_size - 1]; }
+    /**
+     * @return the last element. The vector must not be empty.
+     */
+    inline const T& back() const noexcept { return data()[_size - 1]; }
+    /**
+     * @return the pointer to the elements.
+     */
+    inline T* data() noexcept { return std::launder(reinterpret_cast<T*>(_storage)); }
+    /**
+     * @return the const pointer to the elements.
+     */
+    inline const T* data() const noexcept { return std::launder(reinterpret_cast<const T*>(_storage)); }
+    /**
+     * @return the iterator to the first element.
+     */
+    inline iterator begin() noexcept { return data(); }
+    /**
+     * @return the iterator to the end of the vector.
+     */
+    inline iterator end() noexcept { return data() + _size; }
+    /**
+     * @return the const iterator to the first element.
+     */
+    inline const_iterator begin() const noexcept { return data(); }
+    /**
+     * @return the const iterator to the end of the vector.
+     */
+    inline const_iterator end() const noexcept { return data() + _size; }
+    /**
+     * @return the number of elements.
+     */
+    inline size_type size() const noexcept { return _size; }
+    /**
+     * @return the capacity of the vector.
+     */
+    static constexpr inline size_type capacity() noexcept { return N; }
+    /**
+     * @return `true` if the vector is empty, otherwise `false`.
+     */
+    inline bool empty() const noexcept { return _size == 0; }
+    /**
+     * @return `true` if the vector is full, otherwise `false`.
+     */
+    inline bool full() const noexcept { return _size == N; }
+
+  private:
+    alignas(T) unsigned char _storage[sizeof(T) * (N ? N : 1)]; //! the memory of the elements.
+    size_type _size{0};                                         //! the number of elements.
+};
+
+/*
+ * Constructor with the elements.
+ */
+template<typename T, std::size_t N>
+StaticVector<T, N>::StaticVector(std::initializer_list<T> list) : StaticVector()
+{
+    if(list.size() > N) {
+        throw std::length_error("Error: the number of elements is more than the capacity.");
+    }
+    for(const T& value : list) {
+        emplace_back(value);
+    }
+}
+
+/*
+ * Copy constructor.
+ */
+template<typename T, std::size_t N>
+StaticVector<T, N>::StaticVector(const StaticVector& v) : StaticVector()
+{
+    for(const T& value : v) {
+        emplace_back(value);
+    }
+}
+
+/*
+ * Move constructor.
+ */
+template<typename T, std::size_t N>
+StaticVector<T, N>::StaticVector(StaticVector&& v) noexcept(std::is_nothrow_move_constructible_v<T>) : StaticVector()
+{
+    for(T& value : v) {
+        emplace_back(std::move(value));
+    }
+    v.clear();
+}
+
+/*
+ * Copy assignment operator.
+ */
+template<typename T, std::size_t N>
+StaticVector<T, N>& StaticVector<T, N>::operator=(const StaticVector& v)
+{
+    if(this != &v) {
+        clear();
+        for(const T& value : v) {
+            emplace_back(value);
+        }
+    }
+    return *this;
+}
+
+/*
+ * Move assignment operator.
+ */
+template<typename T, std::size_t N>
+StaticVector<T, N>& StaticVector<T, N>::operator=(StaticVector&& v) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this != &v) {
+        clear();
+        for(T& value : v) {
+            emplace_back(std::move(value));
+        }
+        v.clear();
+    }
+    return *this;
+}
+
+/*
+ * Constructs the element at the end of the vector.
+ */
+template<typename T, std::size_t N>
+template<typename... Args>
+T& StaticVector<T, N>::emplace_back(Args&&... args)
+{
+    if(_size == N) {
+        throw std::length_error("Error: the vector is full.");
+    }
+    T* p = ::new(static_cast<void*>(_storage + _size * sizeof(T))) T(std::forward<Args>(args)...);
+    _size++;
+    return *p;
+}
+
+/*
+ * Removes the last element.
+ */
+template<typename T, std::size_t N>
+void StaticVector<T, N>::pop_back()
+{
+    if(!_size) {
+        throw std::out_of_range("Error: the vector is empty.");
+    }
+    _size--;
+    data()[_size].~T();
+}
+
+/*
+ * Inserts the element before the position.
+ * The element is added to the end and moved to the position by swaps.
+ */
+template<typename T, std::size_t N>
+typename StaticVector<T, N>::iterator StaticVector<T, N>::insert(const_iterator pos, T value)
+{
+    auto i = static_cast<size_type>(pos - begin());
+    emplace_back(std::move(value));
+    for(size_type j = _size - 1; j > i; j--) {
+        std::swap(data()[j], data()[j - 1]);
+    }
+    return begin() + i;
+}
+
+/*
+ * Removes the element from the position.
+ * The next elements are moved back.
+ */
+template<typename T, std::size_t N>
+typename StaticVector<T, N>::iterator StaticVector<T, N>::erase(const_iterator pos)
+{
+    auto i = static_cast<size_type>(pos - begin());
+    for(size_type j = i; j + 1 < _size; j++) {
+        data()[j] = std::move(data()[j + 1]);
+    }
+    pop_back();
+    return begin() + i;
+}
+
+/*
+ * Removes all the elements.
+ */
+template<typename T, std::size_t N>
+void StaticVector<T, N>::clear() noexcept
+{
+    for(size_type i = 0; i < _size; i++) {
+        data()[i].~T();
+    }
+    _size = 0;
+}
+
+/*
+ * Returns the element from the position.
+ */
+template<typename T, std::size_t N>
+T& StaticVector<T, N>::at(size_type i)
+{
+    if(i >= _size) {
+        throw std::out_of_range("Error: the index is out of range.");
+    }
+    return data()[i];
+}
+
+/*
+ * Returns the element from the position.
+ */
+template<typename T, std::size_t N>
+const T& StaticVector<T, N>::at(size_type i) const
+{
+    if(i >= _size) {
+        throw std::out_of_range("Error: the index is out of range.");
+    }
+    return data()[i];
+}
+
+#endif /* __cplusplus */
+
+#endif /* STATIC_VECTOR_H */
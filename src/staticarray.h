@@ -8,8 +8,175 @@
 
 #ifdef __cplusplus
 #include "extensions.h"
+#include <cstdint>
+#include <functional>
 #include <type_traits>
 #include <utility>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace _helpers_staticarray
+{
+/**
+ * The size of the cache line.
+ */
+constexpr std::size_t cache_line = 64;
+/**
+ * The alignment of the array: the arrays of numbers, which take at least one cache line,
+ * are aligned to the cache line, so the vector loads do not cross the cache lines.
+ * This is helper func. Do not use this.
+ */
+template<typename T, std::size_t Size>
+constexpr std::size_t alignment() noexcept
+{
+    return std::is_arithmetic_v<T> && sizeof(T) * Size >= cache_line ? cache_line : alignof(T);
+}
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define STATICARRAY_CAN_CHECK_CONSTANT 1
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+#define STATICARRAY_CAN_CHECK_CONSTANT 1
+#endif
+/**
+ * Checks that the function is evaluated at compile time,
+ * the vector instructions can be used only at run time.
+ * If the compiler cannot check this, the vector instructions are not used.
+ * This is helper func. Do not use this.
+ */
+constexpr bool is_constant_evaluated() noexcept
+{
+#ifdef STATICARRAY_CAN_CHECK_CONSTANT
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+/**
+ * The maximum number of blocks, which are unrolled completely.
+ */
+constexpr std::size_t unroll_limit = 32;
+/**
+ * Calls the function for each block: unrolls all the blocks with `CONSTEXPR_LOOP`,
+ * if there are not many blocks, otherwise unrolls groups of four blocks.
+ * This is helper func. Do not use this.
+ */
+template<std::size_t Blocks, typename F>
+constexpr void for_each_block(F&& func)
+{
+    if constexpr(Blocks <= unroll_limit) {
+        constexpr_extensions::CONSTEXPR_LOOP<Blocks>([&](auto i) { func(std::size_t(i)); });
+    } else {
+        std::size_t b = 0;
+        for(; b + 4 <= Blocks; b += 4) {
+            constexpr_extensions::CONSTEXPR_LOOP<4>([&](auto i) { func(b + i); });
+        }
+        constexpr_extensions::CONSTEXPR_LOOP<Blocks % 4>([&](auto i) { func(b + i); });
+    }
+}
+/**
+ * The vector instructions for the type of elements.
+ * `enabled` is `false`, if the instructions are not supported, then the portable code is used.
+ * This is helper struct. Do not use this.
+ */
+template<typename T>
+struct Simd
+{
+    static constexpr bool enabled = false;
+};
+#if defined(__AVX2__)
+template<>
+struct Simd<float>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 8;
+    using reg = __m256;
+    static inline reg load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static inline void store(float* p, reg a) noexcept { _mm256_storeu_ps(p, a); }
+    static inline reg set1(float v) noexcept { return _mm256_set1_ps(v); }
+    static inline reg add(reg a, reg b) noexcept { return _mm256_add_ps(a, b); }
+#if defined(__FMA__)
+    static inline reg mul_add(reg a, reg b, reg c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+#else
+    static inline reg mul_add(reg a, reg b, reg c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+    static inline reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+    static inline reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+    static inline unsigned equal(reg a, reg b) noexcept
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+};
+template<>
+struct Simd<std::int32_t>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 8;
+    using reg = __m256i;
+    static inline reg load(const std::int32_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+    static inline void store(std::int32_t* p, reg a) noexcept { _mm256_storeu_si256(reinterpret_cast<reg*>(p), a); }
+    static inline reg set1(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+    static inline reg add(reg a, reg b) noexcept { return _mm256_add_epi32(a, b); }
+    static inline reg mul_add(reg a, reg b, reg c) noexcept { return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c); }
+    static inline reg min(reg a, reg b) noexcept { return _mm256_min_epi32(a, b); }
+    static inline reg max(reg a, reg b) noexcept { return _mm256_max_epi32(a, b); }
+    static inline unsigned equal(reg a, reg b) noexcept
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+};
+#elif defined(__SSE2__)
+template<>
+struct Simd<float>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    using reg = __m128;
+    static inline reg load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static inline void store(float* p, reg a) noexcept { _mm_storeu_ps(p, a); }
+    static inline reg set1(float v) noexcept { return _mm_set1_ps(v); }
+    static inline reg add(reg a, reg b) noexcept { return _mm_add_ps(a, b); }
+    static inline reg mul_add(reg a, reg b, reg c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+    static inline reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+    static inline unsigned equal(reg a, reg b) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+};
+#if defined(__SSE4_1__)
+template<>
+struct Simd<std::int32_t>
+{
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    using reg = __m128i;
+    static inline reg load(const std::int32_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const reg*>(p)); }
+    static inline void store(std::int32_t* p, reg a) noexcept { _mm_storeu_si128(reinterpret_cast<reg*>(p), a); }
+    static inline reg set1(std::int32_t v) noexcept { return _mm_set1_epi32(v); }
+    static inline reg add(reg a, reg b) noexcept { return _mm_add_epi32(a, b); }
+    static inline reg mul_add(reg a, reg b, reg c) noexcept { return _mm_add_epi32(_mm_mullo_epi32(a, b), c); }
+    static inline reg min(reg a, reg b) noexcept { return _mm_min_epi32(a, b); }
+    static inline reg max(reg a, reg b) noexcept { return _mm_max_epi32(a, b); }
+    static inline unsigned equal(reg a, reg b) noexcept
+    {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+};
+#endif
+#endif
+/**
+ * Checks that the vector instructions are used for the array.
+ * This is helper func. Do not use this.
+ */
+template<typename T, std::size_t Size>
+constexpr bool use_simd() noexcept
+{
+    if constexpr(Simd<T>::enabled) {
+        return Size >= Simd<T>::lanes;
+    } else {
+        return false;
+    }
+}
+} // namespace _helpers_staticarray
 
 /**
  * The `StaticArray` class.
@@ -36,15 +203,26 @@ class StaticArray
      */
     template<typename... Args, std::enable_if_t<std::conjunction_v<std::is_same<T, Args>...>>* = nullptr>
     constexpr StaticArray(Args&&... list) noexcept;
-    constexpr StaticArray(const StaticArray& a) = delete;
-    constexpr StaticArray(StaticArray&& a) = delete;
+    /**
+     * Copy constructor.
+     */
+    constexpr StaticArray(const StaticArray& a) = default;
+    /**
+     * Move constructor.
+     */
+    constexpr StaticArray(StaticArray&& a) = default;
     /**
      * Destructor.
      */
     ~StaticArray() noexcept = default;
-
-    constexpr StaticArray& operator=(const StaticArray& a) = delete;
-    constexpr StaticArray& operator=(StaticArray&& a) = delete;
+    /**
+     * Copy assignment operator.
+     */
+    constexpr StaticArray& operator=(const StaticArray& a) = default;
+    /**
+     * Move assignment operator.
+     */
+    constexpr StaticArray& operator=(StaticArray&& a) = default;
     /**
      * The `operator[]`. Takes an integral constant with std::size_t type.
      * This method will check ranges!
@@ -60,6 +238,102 @@ class StaticArray
      * @return a value from the position.
      */
     constexpr const T& operator[](std::size_t i) const noexcept;
+    /**
+     * The mutable `operator[]`. Takes an integral constant with std::size_t type.
+     * This method will check ranges!
+     * @param i index. For example: array[Index<I>()] = 5.
+     * @return a reference to the value from the position.
+     */
+    template<std::size_t I>
+    constexpr T& operator[](constexpr_extensions::Index<I> i) noexcept;
+    /**
+     * The mutable `operator[]`.
+     * This method will not check ranges!
+     * @param i index.
+     * @return a reference to the value from the position.
+     */
+    constexpr T& operator[](std::size_t i) noexcept;
+    /**
+     * @return the pointer to the first element.
+     */
+    constexpr inline T* begin() noexcept { return _data; }
+    /**
+     * @return the pointer to the end of the array.
+     */
+    constexpr inline T* end() noexcept { return _data + Size; }
+    /**
+     * @return the const pointer to the first element.
+     */
+    constexpr inline const T* begin() const noexcept { return _data; }
+    /**
+     * @return the const pointer to the end of the array.
+     */
+    constexpr inline const T* end() const noexcept { return _data + Size; }
+    /**
+     * Sets the value to all the elements.
+     * @param value a value.
+     */
+    constexpr void fill(const T& value) noexcept;
+    /**
+     * Replaces each element by the result of the function.
+     * @code
+     * For example: array.transform([](int v) { return v * v; });
+     * @endcode
+     * @param func a function, which takes an element and returns a new element.
+     */
+    template<typename F>
+    constexpr void transform(F func);
+    /**
+     * Sorts the elements at compile time or run time.
+     * Uses the sorting network (Batcher's odd-even merge sort): the comparisons
+     * do not depend on the values, so the small arrays are sorted without branches.
+     * @param comp a function to compare elements, by default is `std::less<T>`.
+     */
+    template<typename Compare = std::less<T>>
+    constexpr void sort(Compare comp = Compare());
+    /**
+     * Checks that the sorted array contains the value.
+     * @param value a value.
+     * @param comp a function, which was used to sort the array, by default is `std::less<T>`.
+     * @return `true` if the array contains the value, otherwise `false`.
+     */
+    template<typename Compare = std::less<T>>
+    constexpr bool binary_search(const T& value, Compare comp = Compare()) const;
+    /**
+     * Returns the sum of the elements.
+     * This function and the functions below use the vector instructions (SSE or AVX2) at run time
+     * for `float` and `int32_t` elements, if the compiler supports them, otherwise and at compile time
+     * the portable code is used. The loops are unrolled: the size is known at compile time.
+     * The vector code adds `float` elements in another order, so the result can differ
+     * from the sequential sum by the rounding error.
+     * @return the sum of the elements.
+     */
+    constexpr T sum() const noexcept;
+    /**
+     * @return the minimum element.
+     */
+    constexpr T min() const noexcept;
+    /**
+     * @return the maximum element.
+     */
+    constexpr T max() const noexcept;
+    /**
+     * Returns the position of the first element, which is equal to the value.
+     * @param value a value.
+     * @return the position, `Size` if there is no such element.
+     */
+    constexpr std::size_t find(const T& value) const noexcept;
+    /**
+     * @param value a value.
+     * @return the number of elements, which are equal to the value.
+     */
+    constexpr std::size_t count_if_equal(const T& value) const noexcept;
+    /**
+     * Returns the dot product: the sum of products of the elements with the same positions.
+     * @param other another array.
+     * @return the dot product.
+     */
+    constexpr T dot(const StaticArray& other) const noexcept;
     /**
      * @return numbers of elements.
      */
@@ -79,16 +353,33 @@ class StaticArray
      * @return an array with the sequence.
      */
     static constexpr StaticArray<T, Size> make_sequence() noexcept;
+    /**
+     * Creates an array from the function of the index.
+     * The function is called at compile time, if the result is `constexpr`,
+     * so the table is stored in the read-only data instead of initialization at run time.
+     * @code
+     * For example: constexpr auto squares = StaticArray<int, 5>::generate([](std::size_t i) { return int(i * i); });
+     * @endcode
+     * @param func a function, which takes the index and returns the element.
+     * @return an array with the results of the function.
+     */
+    template<typename F>
+    static constexpr StaticArray<T, Size> generate(F func);
 
   private:
     /**
      * Makes sequence.
      */
-    template<T... Is>
-    static constexpr auto make_sequence_p(std::integer_sequence<T, Is...>) noexcept;
+    template<std::size_t... Is>
+    static constexpr auto make_sequence_p(std::index_sequence<Is...>) noexcept;
+    /**
+     * Generates the array.
+     */
+    template<typename F, std::size_t... Is>
+    static constexpr auto generate_p(F& func, std::index_sequence<Is...>);
 
   private:
-    T _data[Size]; //! array
+    alignas(_helpers_staticarray::alignment<T, Size>()) T _data[Size]; //! array
     std::size_t _capacity;
     std::size_t _count;
     /**
@@ -106,6 +397,11 @@ class StaticArray
      */
     template<typename... Args>
     constexpr void create_indexes(Args&&... args) noexcept;
+    /**
+     * Swaps two elements, if they are not in the order.
+     */
+    template<typename Compare>
+    constexpr void compare_exchange(std::size_t i, std::size_t j, Compare& comp);
 };
 
 /*
@@ -146,22 +442,293 @@ constexpr const T& StaticArray<T, Size>::operator[](std::size_t i) const noexcep
 {
     return _data[i];
 }
+/*
+ * The mutable `operator[]`. Takes a integral constant with std::size_t type.
+ * This method will check ranges!
+ */
+template<typename T, std::size_t Size>
+template<std::size_t I>
+constexpr T& StaticArray<T, Size>::operator[](constexpr_extensions::Index<I> i) noexcept
+{
+    static_assert(std::conjunction_v<std::bool_constant<(i < Size)>>, "Index must be less than size of array");
+    return _data[i];
+}
+/*
+ * The mutable `operator[]`.
+ * This method will not check ranges!
+ */
+template<typename T, std::size_t Size>
+constexpr T& StaticArray<T, Size>::operator[](std::size_t i) noexcept
+{
+    return _data[i];
+}
+/*
+ * Sets the value to all the elements.
+ */
+template<typename T, std::size_t Size>
+constexpr void StaticArray<T, Size>::fill(const T& value) noexcept
+{
+    for(std::size_t i = 0; i < Size; i++) {
+        _data[i] = value;
+    }
+    _count = Size;
+}
+/*
+ * Replaces each element by the result of the function.
+ */
+template<typename T, std::size_t Size>
+template<typename F>
+constexpr void StaticArray<T, Size>::transform(F func)
+{
+    for(std::size_t i = 0; i < Size; i++) {
+        _data[i] = func(_data[i]);
+    }
+}
+/*
+ * Sorts the elements.
+ * Batcher's odd-even merge sort, the pairs of indexes are out of range
+ * for the size, which is not a power of two, such pairs are skipped.
+ */
+template<typename T, std::size_t Size>
+template<typename Compare>
+constexpr void StaticArray<T, Size>::sort(Compare comp)
+{
+    for(std::size_t p = 1; p < Size; p <<= 1) {
+        for(std::size_t k = p; k >= 1; k >>= 1) {
+            for(std::size_t j = k % p; j + k < Size; j += 2 * k) {
+                for(std::size_t i = 0; i < k && i + j + k < Size; i++) {
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        compare_exchange(i + j, i + j + k, comp);
+                    }
+                }
+            }
+        }
+    }
+}
+/*
+ * Checks that the sorted array contains the value.
+ */
+template<typename T, std::size_t Size>
+template<typename Compare>
+constexpr bool StaticArray<T, Size>::binary_search(const T& value, Compare comp) const
+{
+    std::size_t first = 0;
+    std::size_t last = Size;
+    while(first < last) {
+        std::size_t middle = first + (last - first) / 2;
+        if(comp(_data[middle], value)) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first < Size && !comp(value, _data[first]);
+}
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+/*
+ * The sum of the elements.
+ * The vector code keeps the sums of the lanes and adds them at the end.
+ */
+template<typename T, std::size_t Size>
+constexpr T StaticArray<T, Size>::sum() const noexcept
+{
+    using namespace _helpers_staticarray;
+    T result = T{};
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto acc = simd::set1(T{});
+            for_each_block<Size / simd::lanes>([&](std::size_t b) { acc = simd::add(acc, simd::load(_data + b * simd::lanes)); });
+            T lanes[simd::lanes]{};
+            simd::store(lanes, acc);
+            constexpr_extensions::CONSTEXPR_LOOP<simd::lanes>([&](auto i) { result += lanes[i]; });
+            constexpr_extensions::CONSTEXPR_LOOP<Size % simd::lanes>([&](auto i) { result += _data[Size - i - 1]; });
+            return result;
+        }
+    }
+    for_each_block<Size>([&](std::size_t i) { result += _data[i]; });
+    return result;
+}
+/*
+ * The minimum element.
+ * The vector code starts from the first block, the first block is taken twice.
+ */
+template<typename T, std::size_t Size>
+constexpr T StaticArray<T, Size>::min() const noexcept
+{
+    using namespace _helpers_staticarray;
+    T result = _data[0];
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto acc = simd::load(_data);
+            for_each_block<Size / simd::lanes>([&](std::size_t b) { acc = simd::min(acc, simd::load(_data + b * simd::lanes)); });
+            T lanes[simd::lanes]{};
+            simd::store(lanes, acc);
+            constexpr_extensions::CONSTEXPR_LOOP<simd::lanes>([&](auto i) { result = lanes[i] < result ? lanes[i] : result; });
+            constexpr_extensions::CONSTEXPR_LOOP<Size % simd::lanes>([&](auto i) {
+                result = _data[Size - i - 1] < result ? _data[Size - i - 1] : result;
+            });
+            return result;
+        }
+    }
+    for_each_block<Size>([&](std::size_t i) { result = _data[i] < result ? _data[i] : result; });
+    return result;
+}
+/*
+ * The maximum element.
+ * The vector code starts from the first block, the first block is taken twice.
+ */
+template<typename T, std::size_t Size>
+constexpr T StaticArray<T, Size>::max() const noexcept
+{
+    using namespace _helpers_staticarray;
+    T result = _data[0];
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto acc = simd::load(_data);
+            for_each_block<Size / simd::lanes>([&](std::size_t b) { acc = simd::max(acc, simd::load(_data + b * simd::lanes)); });
+            T lanes[simd::lanes]{};
+            simd::store(lanes, acc);
+            constexpr_extensions::CONSTEXPR_LOOP<simd::lanes>([&](auto i) { result = result < lanes[i] ? lanes[i] : result; });
+            constexpr_extensions::CONSTEXPR_LOOP<Size % simd::lanes>([&](auto i) {
+                result = result < _data[Size - i - 1] ? _data[Size - i - 1] : result;
+            });
+            return result;
+        }
+    }
+    for_each_block<Size>([&](std::size_t i) { result = result < _data[i] ? _data[i] : result; });
+    return result;
+}
+/*
+ * The position of the first element, which is equal to the value.
+ * The blocks are not unrolled here: the search stops at the first found block.
+ */
+template<typename T, std::size_t Size>
+constexpr std::size_t StaticArray<T, Size>::find(const T& value) const noexcept
+{
+    using namespace _helpers_staticarray;
+    std::size_t first = 0;
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto v = simd::set1(value);
+            for(; first + simd::lanes <= Size; first += simd::lanes) {
+                unsigned mask = simd::equal(simd::load(_data + first), v);
+                if(mask) {
+                    return first + static_cast<std::size_t>(__builtin_ctz(mask));
+                }
+            }
+        }
+    }
+    for(std::size_t i = first; i < Size; i++) {
+        if(_data[i] == value) {
+            return i;
+        }
+    }
+    return Size;
+}
+/*
+ * The number of elements, which are equal to the value.
+ * The vector code counts the bits of the comparison masks.
+ */
+template<typename T, std::size_t Size>
+constexpr std::size_t StaticArray<T, Size>::count_if_equal(const T& value) const noexcept
+{
+    using namespace _helpers_staticarray;
+    std::size_t result = 0;
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto v = simd::set1(value);
+            for_each_block<Size / simd::lanes>([&](std::size_t b) {
+                result += static_cast<std::size_t>(__builtin_popcount(simd::equal(simd::load(_data + b * simd::lanes), v)));
+            });
+            constexpr_extensions::CONSTEXPR_LOOP<Size % simd::lanes>([&](auto i) { result += _data[Size - i - 1] == value; });
+            return result;
+        }
+    }
+    for_each_block<Size>([&](std::size_t i) { result += _data[i] == value; });
+    return result;
+}
+/*
+ * The dot product.
+ */
+template<typename T, std::size_t Size>
+constexpr T StaticArray<T, Size>::dot(const StaticArray& other) const noexcept
+{
+    using namespace _helpers_staticarray;
+    T result = T{};
+    if constexpr(use_simd<T, Size>()) {
+        if(!is_constant_evaluated()) {
+            using simd = Simd<T>;
+            auto acc = simd::set1(T{});
+            for_each_block<Size / simd::lanes>([&](std::size_t b) {
+                acc = simd::mul_add(simd::load(_data + b * simd::lanes), simd::load(other._data + b * simd::lanes), acc);
+            });
+            T lanes[simd::lanes]{};
+            simd::store(lanes, acc);
+            constexpr_extensions::CONSTEXPR_LOOP<simd::lanes>([&](auto i) { result += lanes[i]; });
+            constexpr_extensions::CONSTEXPR_LOOP<Size % simd::lanes>([&](auto i) {
+                result += _data[Size - i - 1] * other._data[Size - i - 1];
+            });
+            return result;
+        }
+    }
+    for_each_block<Size>([&](std::size_t i) { result += _data[i] * other._data[i]; });
+    return result;
+}
+#pragma GCC diagnostic pop
+/*
+ * Swaps two elements, if they are not in the order.
+ */
+template<typename T, std::size_t Size>
+template<typename Compare>
+constexpr void StaticArray<T, Size>::compare_exchange(std::size_t i, std::size_t j, Compare& comp)
+{
+    if(comp(_data[j], _data[i])) {
+        T tmp = std::move(_data[i]);
+        _data[i] = std::move(_data[j]);
+        _data[j] = std::move(tmp);
+    }
+}
 /*
  * Makes sequence.
  */
 template<typename T, std::size_t Size>
 constexpr StaticArray<T, Size> StaticArray<T, Size>::make_sequence() noexcept
 {
-    return make_sequence_p(std::make_integer_sequence<T, Size>{});
+    return make_sequence_p(std::make_index_sequence<Size>{});
 }
 /*
  * Makes sequence.
  */
 template<typename T, std::size_t Size>
-template<T... Is>
-constexpr auto StaticArray<T, Size>::make_sequence_p(std::integer_sequence<T, Is...>) noexcept
+template<std::size_t... Is>
+constexpr auto StaticArray<T, Size>::make_sequence_p(std::index_sequence<Is...>) noexcept
+{
+    return StaticArray<T, Size>(static_cast<T>(Is)...);
+}
+/*
+ * Creates an array from the function of the index.
+ */
+template<typename T, std::size_t Size>
+template<typename F>
+constexpr StaticArray<T, Size> StaticArray<T, Size>::generate(F func)
+{
+    return generate_p(func, std::make_index_sequence<Size>{});
+}
+/*
+ * Generates the array.
+ * The function is called in the order of the indexes.
+ */
+template<typename T, std::size_t Size>
+template<typename F, std::size_t... Is>
+constexpr auto StaticArray<T, Size>::generate_p(F& func, std::index_sequence<Is...>)
 {
-    return StaticArray<T, Size>(Is...);
+    return StaticArray<T, Size>{static_cast<T>(func(Is))...};
 }
 /*
  * Sets data to array.
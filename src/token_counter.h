@@ -0,0 +1,415 @@
+/**
+ * @file token_counter.h
+ *
+ * Contains the class `TokenCounter`.
+ */
+#ifndef TOKEN_COUNTER_H
+#define TOKEN_COUNTER_H
+
+#ifdef __cplusplus
+#include "flat_map.h"
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * This class counts the text tokens (words).
+ * The tokens are passed as `std::string_view`, so the counting does not allocate memory
+ * for the tokens, which were counted before: the token is found in the table by its view.
+ * The first occurrence of a token is copied into the arena, the table keeps the views to the arena,
+ * so the views are valid while the counter exists.
+ */
+class TokenCounter
+{
+  public:
+    /**
+     * Pair type: first - the token, second - the number of such tokens.
+     */
+    using pair_t = std::pair<std::string_view, unsigned int>;
+    /**
+     * Vector type. Contains `pair_t` pairs.
+     */
+    using vector_t = std::vector<pair_t>;
+    /**
+     * Map type: key - the token in the arena, value - the number of such tokens.
+     */
+    using map_t = FlatMap<std::string_view, unsigned int>;
+
+  public:
+    /**
+     * Default constructor.
+     */
+    TokenCounter() = default;
+    /**
+     * Constructor, counts the tokens of the sequence.
+     * @param _begin the iterator to the beginning of the sequence of tokens.
+     * @param _end the iterator to the end of the sequence of tokens.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    TokenCounter(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * The class is not copyable: the views point to its own arena.
+     */
+    TokenCounter(const TokenCounter&) = delete;
+    TokenCounter& operator=(const TokenCounter&) = delete;
+    /**
+     * Move constructor.
+     * The arena blocks are moved, so the views stay valid.
+     */
+    TokenCounter(TokenCounter&& other) noexcept;
+    TokenCounter& operator=(TokenCounter&& other) noexcept;
+    /**
+     * Destructor.
+     */
+    virtual ~TokenCounter() = default;
+    /**
+     * Counts a token.
+     * @param token a token.
+     * @param n the number of such tokens, by default is `1`.
+     */
+    void push(std::string_view token, unsigned int n = 1);
+    /**
+     * Counts the tokens of the sequence.
+     * @param _begin the iterator to the beginning of the sequence of tokens.
+     * @param _end the iterator to the end of the sequence of tokens.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    void update(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Splits the text by the whitespace characters and counts the tokens.
+     * @param text a text.
+     */
+    void count_text(std::string_view text);
+    /**
+     * Adds the numbers of another counter, copies its new tokens into the arena.
+     * @param other another counter.
+     */
+    void merge(const TokenCounter& other);
+    /**
+     * Adds the numbers of another counter, takes its arena without copying the tokens.
+     * @param other another counter, which is empty after this.
+     */
+    void merge(TokenCounter&& other);
+    /**
+     * Returns the vector of pairs, sorted by the greater number of tokens.
+     * The same as `Counter::most_common`.
+     * @param n the number of the first tokens, by default is -1.
+     * @return the vector of pairs.
+     */
+    vector_t most_common(int n = -1) const;
+    /**
+     * @param token a token.
+     * @return the number of such tokens.
+     */
+    unsigned int count(std::string_view token) const;
+    /**
+     * @return the number of different tokens.
+     */
+    inline std::size_t size() const noexcept { return _elements.size(); }
+    /**
+     * Counts the tokens of the file in several threads.
+     * The file is mapped into memory and divided into the parts by the whitespace characters,
+     * each thread counts its part, after this the counters are merged.
+     * If the file cannot be read, throws the `runtime_error` exception.
+     * @param path the path to the file.
+     * @param threads the number of threads, `0` - the number of hardware threads.
+     * @return the counter.
+     */
+    static TokenCounter count_file(const std::string& path, unsigned int threads = 0);
+    /**
+     * The minimum size of the part of the file for one thread.
+     */
+    static constexpr std::size_t parallel_threshold = 1 << 16;
+
+  private:
+    /**
+     * Copies the token into the arena.
+     * @return the view to the copy.
+     */
+    std::string_view intern(std::string_view token);
+    /**
+     * @return `true` if the character is a whitespace character.
+     */
+    static inline bool is_space(char c) noexcept
+    {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+    }
+    /**
+     * Compares two pair
+     */
+    static inline bool sort_pair(const pair_t& a, const pair_t& b) noexcept
+    {
+        return a.second == b.second ? a.first < b.first : a.second > b.second;
+    }
+    /**
+     * The size of the arena block.
+     */
+    static constexpr std::size_t block_size = 1 << 16;
+
+  private:
+    map_t _elements{};                             //! the numbers of the tokens.
+    std::vector<std::unique_ptr<char[]>> _blocks{}; //! the arena blocks.
+    std::size_t _used{block_size};                 //! the used size of the last block.
+};
+
+/*
+ * Constructor.
+ * Counts the tokens of the sequence.
+ */
+template<typename IteratorBegin, typename IteratorEnd>
+TokenCounter::TokenCounter(IteratorBegin _begin, IteratorEnd _end)
+{
+    update(_begin, _end);
+}
+
+/*
+ * Move constructor.
+ * The moved-from counter is left empty: no blocks, a new block for the next token.
+ */
+inline TokenCounter::TokenCounter(TokenCounter&& other) noexcept
+    : _elements(std::move(other._elements)), _blocks(std::move(other._blocks)), _used(other._used)
+{
+    other._blocks.clear();
+    other._used = block_size;
+}
+
+/*
+ * Move assignment.
+ */
+inline TokenCounter& TokenCounter::operator=(TokenCounter&& other) noexcept
+{
+    if(this != &other) {
+        _elements = std::move(other._elements);
+        _blocks = std::move(other._blocks);
+        _used = other._used;
+        other._blocks.clear();
+        other._used = block_size;
+    }
+    return *this;
+}
+
+/*
+ * The `update` function.
+ */
+template<typename IteratorBegin, typename IteratorEnd>
+void TokenCounter::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    for(auto it = _begin; it != _end; it++) {
+        push(std::string_view(*it));
+    }
+}
+
+/*
+ * The `push` function.
+ * The token is copied only if it is new.
+ */
+inline void TokenCounter::push(std::string_view token, unsigned int n)
+{
+    auto it = _elements.find(token);
+    if(it != _elements.end()) {
+        it->second += n;
+    } else {
+        _elements[intern(token)] = n;
+    }
+}
+
+/*
+ * The `count_text` function.
+ */
+inline void TokenCounter::count_text(std::string_view text)
+{
+    std::size_t i = 0;
+    const std::size_t length = text.size();
+    while(i < length) {
+        while(i < length && is_space(text[i])) {
+            i++;
+        }
+        std::size_t first = i;
+        while(i < length && !is_space(text[i])) {
+            i++;
+        }
+        if(i > first) {
+            push(text.substr(first, i - first));
+        }
+    }
+}
+
+/*
+ * The `merge` function.
+ */
+inline void TokenCounter::merge(const TokenCounter& other)
+{
+    for(const auto& p : other._elements) {
+        push(p.first, p.second);
+    }
+}
+
+/*
+ * The `merge` function.
+ * The views of another counter point to its blocks, the blocks are moved here,
+ * so the new tokens are inserted without copying.
+ */
+inline void TokenCounter::merge(TokenCounter&& other)
+{
+    if(this == &other) {
+        return;
+    }
+    // The last block of this counter stays the last block.
+    _blocks.insert(_blocks.begin(),
+                   std::make_move_iterator(other._blocks.begin()),
+                   std::make_move_iterator(other._blocks.end()));
+    for(const auto& p : other._elements) {
+        _elements[p.first] += p.second;
+    }
+    other._blocks.clear();
+    other._elements.clear();
+    other._used = block_size;
+}
+
+/*
+ * The `most_common` function.
+ * Sorts only the first `n` pairs.
+ */
+inline TokenCounter::vector_t TokenCounter::most_common(int n) const
+{
+    vector_t result(_elements.begin(), _elements.end());
+    std::size_t number = result.size();
+    if(n != -1 && static_cast<std::size_t>(n) <= result.size()) {
+        number = static_cast<std::size_t>(n);
+    }
+    auto middle = result.begin() + static_cast<std::ptrdiff_t>(number);
+    std::partial_sort(result.begin(), middle, result.end(), sort_pair);
+    result.erase(middle, result.end());
+    return result;
+}
+
+/*
+ * The `count` function.
+ */
+inline unsigned int TokenCounter::count(std::string_view token) const
+{
+    auto it = _elements.find(token);
+    return it != _elements.end() ? it->second : 0;
+}
+
+/*
+ * The `intern` function.
+ * The long tokens get their own blocks.
+ */
+inline std::string_view TokenCounter::intern(std::string_view token)
+{
+    if(token.empty()) {
+        // The empty token needs no memory, the arena may have no blocks.
+        return std::string_view();
+    }
+    char* dst = nullptr;
+    if(token.size() > block_size / 4) {
+        auto block = std::make_unique<char[]>(token.size());
+        dst = block.get();
+        // Keeps the current block the last one.
+        _blocks.insert(_blocks.empty() ? _blocks.end() : _blocks.end() - 1, std::move(block));
+    } else {
+        if(_used + token.size() > block_size) {
+            _blocks.push_back(std::make_unique<char[]>(block_size));
+            _used = 0;
+        }
+        dst = _blocks.back().get() + _used;
+        _used += token.size();
+    }
+    std::memcpy(dst, token.data(), token.size());
+    return std::string_view(dst, token.size());
+}
+
+/*
+ * The static `count_file` function.
+ * The borders of the parts are moved to the whitespace characters, so the tokens are not divided.
+ */
+inline TokenCounter TokenCounter::count_file(const std::string& path, unsigned int threads)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd == -1) {
+        throw std::runtime_error("Error: cannot open the file " + path + ".");
+    }
+    struct stat info{};
+    if(::fstat(fd, &info) == -1) {
+        ::close(fd);
+        throw std::runtime_error("Error: cannot read the file " + path + ".");
+    }
+    TokenCounter result;
+    auto length = static_cast<std::size_t>(info.st_size);
+    if(!length) {
+        ::close(fd);
+        return result;
+    }
+    void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(mapped == MAP_FAILED) {
+        throw std::runtime_error("Error: cannot map the file " + path + ".");
+    }
+    ::madvise(mapped, length, MADV_SEQUENTIAL);
+    std::string_view text(static_cast<const char*>(mapped), length);
+
+    if(!threads) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads = static_cast<unsigned int>(std::min<std::size_t>(threads, std::max<std::size_t>(length / parallel_threshold, 1)));
+    std::vector<std::size_t> borders(threads + 1, length);
+    borders[0] = 0;
+    for(unsigned int i = 1; i < threads; i++) {
+        std::size_t pos = std::max(length / threads * i, borders[i - 1]);
+        while(pos < length && !is_space(text[pos])) {
+            pos++;
+        }
+        borders[i] = pos;
+    }
+
+    std::vector<TokenCounter> counters(threads - 1);
+    std::vector<std::exception_ptr> errors(threads - 1);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    // The started threads are joined in all cases: if a thread cannot be started or the current thread throws.
+    std::exception_ptr error = nullptr;
+    try {
+        for(unsigned int i = 0; i + 1 < threads; i++) {
+            workers.emplace_back([&, i]() {
+                try {
+                    counters[i].count_text(text.substr(borders[i], borders[i + 1] - borders[i]));
+                } catch(...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        result.count_text(text.substr(borders[threads - 1], borders[threads] - borders[threads - 1]));
+    } catch(...) {
+        error = std::current_exception();
+    }
+    for(auto& worker : workers) {
+        worker.join();
+    }
+    ::munmap(mapped, length);
+    for(unsigned int i = 0; i + 1 < threads; i++) {
+        if(errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        result.merge(std::move(counters[i]));
+    }
+    if(error) {
+        std::rethrow_exception(error);
+    }
+    return result;
+}
+
+#endif /* __cplusplus */
+
+#endif /* TOKEN_COUNTER_H */
@@ -0,0 +1,158 @@
+/**
+ * @file type_erased.h
+ *
+ * Contains the type-erased elements, which are used by the C interfaces of the C++ containers.
+ */
+#ifndef TYPE_ERASED_H
+#define TYPE_ERASED_H
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string_view>
+
+namespace _helpers_type_erased
+{
+/**
+ * The comparison function of C: negative if the first element is less, `0` if the elements are equal.
+ */
+using compare_t = int (*)(const void*, const void*);
+/**
+ * The hash function of C.
+ */
+using hash_t = size_t (*)(const void*);
+/**
+ * The maximum size of an element, which is stored in the container.
+ */
+constexpr std::size_t max_size = 256;
+/**
+ * The type of the elements: the size and the functions, which are passed by the C code.
+ * The bytes are compared by `memcmp` and hashed as a string, if the functions are not passed.
+ */
+struct element_type
+{
+    std::size_t size;  //! the size of an element.
+    compare_t compare; //! the comparison function, can be `NULL`.
+    hash_t hash;       //! the hash function, can be `NULL`.
+
+    inline int cmp(const void* a, const void* b) const
+    {
+        return compare ? compare(a, b) : std::memcmp(a, b, size);
+    }
+    inline std::size_t hash_of(const void* a) const
+    {
+        return hash ? hash(a) : std::hash<std::string_view>()(std::string_view(static_cast<const char*>(a), size));
+    }
+};
+/**
+ * The element, which is stored in the C++ container.
+ * The bytes are stored in the element, so the container keeps them in its own node,
+ * the element is compared by the functions of its type.
+ * @tparam N the capacity of the element, not less than the size of the type.
+ */
+template<std::size_t N>
+struct element
+{
+    const element_type* type{nullptr};                  //! the type of the element.
+    alignas(std::max_align_t) unsigned char bytes[N]{}; //! the value.
+
+    /**
+     * Creates the element from the bytes.
+     */
+    static inline element make(const element_type* t, const void* value)
+    {
+        element e;
+        e.type = t;
+        std::memcpy(e.bytes, value, t->size);
+        return e;
+    }
+    /**
+     * Copies the value into the buffer.
+     */
+    inline void copy_to(void* buffer) const { std::memcpy(buffer, bytes, type->size); }
+
+    friend inline bool operator<(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) < 0; }
+    friend inline bool operator>(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) > 0; }
+    friend inline bool operator<=(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) <= 0; }
+    friend inline bool operator>=(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) >= 0; }
+    friend inline bool operator==(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) == 0; }
+    friend inline bool operator!=(const element& a, const element& b) { return a.type->cmp(a.bytes, b.bytes) != 0; }
+};
+/**
+ * The hash function of the elements.
+ */
+template<std::size_t N>
+struct element_hash
+{
+    inline std::size_t operator()(const element<N>& e) const { return e.type->hash_of(e.bytes); }
+};
+/**
+ * The iterator, which creates the elements from the contiguous array of C.
+ */
+template<std::size_t N>
+class element_iterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = element<N>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const element<N>*;
+    using reference = element<N>;
+
+    element_iterator(const element_type* t, const void* p) : type(t), current(static_cast<const unsigned char*>(p)) {}
+
+    inline element<N> operator*() const { return element<N>::make(type, current); }
+    inline element_iterator& operator++()
+    {
+        current += type->size;
+        return *this;
+    }
+    inline element_iterator operator++(int)
+    {
+        element_iterator old = *this;
+        current += type->size;
+        return old;
+    }
+    inline bool operator==(const element_iterator& rhs) const { return current == rhs.current; }
+    inline bool operator!=(const element_iterator& rhs) const { return current != rhs.current; }
+
+  private:
+    const element_type* type;     //! the type of the elements.
+    const unsigned char* current; //! the pointer to the current element.
+};
+/**
+ * Creates the engine, which stores the elements of the nearest capacity: 8, 16, ..., 256 bytes.
+ * The engines implement the same interface `Core`, so the C functions do not depend on the size.
+ * @tparam Engine the template of the engine, which is parametrized by the capacity.
+ * @tparam Core the interface of the engines.
+ * @param type the type of the elements.
+ * @return the engine, `nullptr` if the size is `0` or more than `max_size`.
+ */
+template<template<std::size_t> class Engine, typename Core>
+Core* make_engine(const element_type* type)
+{
+    const std::size_t size = type->size;
+    if(size == 0 || size > max_size) {
+        return nullptr;
+    }
+    if(size <= 8) {
+        return new Engine<8>(type);
+    }
+    if(size <= 16) {
+        return new Engine<16>(type);
+    }
+    if(size <= 32) {
+        return new Engine<32>(type);
+    }
+    if(size <= 64) {
+        return new Engine<64>(type);
+    }
+    if(size <= 128) {
+        return new Engine<128>(type);
+    }
+    return new Engine<256>(type);
+}
+} // namespace _helpers_type_erased
+
+#endif /* TYPE_ERASED_H */
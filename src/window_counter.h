@@ -0,0 +1,244 @@
+/**
+ * @file window_counter.h
+ *
+ * Contains the class `WindowCounter`.
+ */
+#ifndef WINDOW_COUNTER_H
+#define WINDOW_COUNTER_H
+
+#ifdef __cplusplus
+#include "counter.h"
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * This class counts the elements in a sliding window: the last `N` elements or the last period of time.
+ * The window is divided into buckets, each bucket is a counter of its elements.
+ * The counter of the window is updated by each element, and the oldest bucket is
+ * subtracted from it when the window moves, so the window is never counted again.
+ * The window moves by one bucket, so the oldest elements are expired by buckets.
+ * @tparam T type of the elements.
+ * @tparam SortFirst sort by first element or not, the same as `Counter`.
+ * @tparam Map type of the map, the same as `Counter`.
+ * @tparam Clock the clock for the time-based window.
+ */
+template<typename T,
+         bool SortFirst = true,
+         typename Map = std::unordered_map<T, unsigned int>,
+         typename Clock = std::chrono::steady_clock>
+class WindowCounter
+{
+  public:
+    /**
+     * Counter type of the window and buckets.
+     */
+    using counter_t = Counter<T, SortFirst, Map>;
+    /**
+     * Vector type. Contains pairs: the element and the number of such elements.
+     */
+    using vector_t = typename counter_t::vector_t;
+    /**
+     * Duration type of the clock.
+     */
+    using duration = typename Clock::duration;
+
+  public:
+    /**
+     * Constructor of the count-based window.
+     * The window contains the last `buckets * events` elements, the oldest `events` elements are expired together.
+     * If the number of buckets or events is `0`, throws the `invalid_argument` exception.
+     * @param buckets the number of buckets.
+     * @param events the number of elements in each bucket.
+     */
+    WindowCounter(std::size_t buckets, std::size_t events);
+    /**
+     * Constructor of the time-based window.
+     * The window contains the elements of the last `buckets * period` time, the elements of the oldest
+     * period are expired together. If the number of buckets is `0` or the period is not positive,
+     * throws the `invalid_argument` exception.
+     * @param buckets the number of buckets.
+     * @param period the period of each bucket.
+     */
+    WindowCounter(std::size_t buckets, duration period);
+    /**
+     * Destructor.
+     */
+    virtual ~WindowCounter() = default;
+    /**
+     * Counts a new element.
+     * @param element a new element.
+     */
+    void push(const T& element);
+    /**
+     * Counts new elements.
+     * @param _begin the iterator to the beginning of the sequence.
+     * @param _end the iterator to the end of the sequence.
+     */
+    template<typename IteratorBegin, typename IteratorEnd>
+    void update(IteratorBegin _begin, IteratorEnd _end);
+    /**
+     * Returns the most common elements of the window, the same as `Counter::most_common`.
+     * @param n the number of the first elements, by default is -1.
+     * @return the vector of pairs.
+     */
+    vector_t most_common(int n = -1);
+    /**
+     * Moves the window by one bucket: expires the oldest bucket.
+     */
+    void rotate();
+    /**
+     * @return the number of elements in the window.
+     */
+    unsigned long total();
+    /**
+     * @return the number of different elements in the window.
+     */
+    std::size_t size();
+    /**
+     * @return the number of buckets.
+     */
+    inline std::size_t buckets() const noexcept { return _buckets.size(); }
+
+  private:
+    /**
+     * Moves the window, if the period of the current bucket is over.
+     */
+    void expire();
+
+  private:
+    counter_t _window;                   //! the counter of all the buckets.
+    std::vector<counter_t> _buckets;     //! the ring of buckets.
+    std::vector<unsigned long> _totals;  //! the number of elements in each bucket.
+    std::size_t _head{0};                //! the current bucket.
+    std::size_t _events{0};              //! the number of elements in each bucket, `0` - the time-based window.
+    duration _period{};                  //! the period of each bucket.
+    typename Clock::time_point _start{}; //! the beginning of the current bucket.
+};
+
+/*
+ * Constructor.
+ * The count-based window.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+WindowCounter<T, SortFirst, Map, Clock>::WindowCounter(std::size_t buckets, std::size_t events) :
+    _window(Map()), _buckets(buckets, counter_t(Map())), _totals(buckets, 0), _events(events)
+{
+    if(!buckets || !events) {
+        throw std::invalid_argument("Error: the number of buckets and events must be more than 0.");
+    }
+}
+
+/*
+ * Constructor.
+ * The time-based window.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+WindowCounter<T, SortFirst, Map, Clock>::WindowCounter(std::size_t buckets, duration period) :
+    _window(Map()), _buckets(buckets, counter_t(Map())), _totals(buckets, 0), _period(period), _start(Clock::now())
+{
+    if(!buckets || period <= duration::zero()) {
+        throw std::invalid_argument("Error: the number of buckets and the period must be more than 0.");
+    }
+}
+
+/*
+ * The `push` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+void WindowCounter<T, SortFirst, Map, Clock>::push(const T& element)
+{
+    expire();
+    if(_events && _totals[_head] == _events) {
+        rotate();
+    }
+    const T* e = &element;
+    _buckets[_head].update(e, e + 1);
+    _window.update(e, e + 1);
+    _totals[_head]++;
+}
+
+/*
+ * The `update` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+template<typename IteratorBegin, typename IteratorEnd>
+void WindowCounter<T, SortFirst, Map, Clock>::update(IteratorBegin _begin, IteratorEnd _end)
+{
+    for(auto it = _begin; it != _end; it++) {
+        push(*it);
+    }
+}
+
+/*
+ * The `most_common` function.
+ * The counter of the window is sorted only if the window was changed.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+typename WindowCounter<T, SortFirst, Map, Clock>::vector_t WindowCounter<T, SortFirst, Map, Clock>::most_common(int n)
+{
+    expire();
+    return _window.most_common(n);
+}
+
+/*
+ * The `rotate` function.
+ * The next bucket is the oldest, its elements are subtracted from the window.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+void WindowCounter<T, SortFirst, Map, Clock>::rotate()
+{
+    _head = (_head + 1) % _buckets.size();
+    _window.subtract(_buckets[_head]);
+    _buckets[_head] = counter_t(Map());
+    _totals[_head] = 0;
+}
+
+/*
+ * The `total` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+unsigned long WindowCounter<T, SortFirst, Map, Clock>::total()
+{
+    expire();
+    unsigned long result = 0;
+    for(auto t : _totals) {
+        result += t;
+    }
+    return result;
+}
+
+/*
+ * The `size` function.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+std::size_t WindowCounter<T, SortFirst, Map, Clock>::size()
+{
+    expire();
+    return _window.size();
+}
+
+/*
+ * The `expire` function.
+ * If all the buckets are expired, the window starts from the current period.
+ */
+template<typename T, bool SortFirst, typename Map, typename Clock>
+void WindowCounter<T, SortFirst, Map, Clock>::expire()
+{
+    if(_events) {
+        return;
+    }
+    auto now = Clock::now();
+    for(std::size_t i = 0; now - _start >= _period; i++) {
+        if(i == _buckets.size()) {
+            _start += ((now - _start) / _period) * _period;
+            break;
+        }
+        rotate();
+        _start += _period;
+    }
+}
+
+#endif /* __cplusplus */
+
+#endif /* WINDOW_COUNTER_H */
@@ -0,0 +1,372 @@
+#ifndef COUNTER_PERF_H
+#define COUNTER_PERF_H
+
+#include "counter.h"
+#include "count_min_sketch.h"
+#include "concurrent_counter.h"
+#include "token_counter.h"
+#include "performance.h"
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <string>
+#include <sstream>
+#include <iterator>
+
+class CounterPerfomance
+    : public Perfomance
+    , public perf_clock::Timer
+    , public print::Output
+{
+  public:
+    enum ACTION
+    {
+        CREATE,
+        UPDATE,
+        MOST_COMMON,
+        PARALLEL,
+        FLAT_MAP,
+        SKETCH,
+        DENSE,
+        CONCURRENT,
+        TOKENS
+    };
+
+  private:
+    std::vector<ACTION> actions{};
+    int number{1000};
+    int distinct{1000};
+
+  public:
+    CounterPerfomance() = default;
+    inline void set_number(int n) noexcept { number = n; }
+    inline void set_distinct(int n) noexcept { distinct = n; }
+    template<typename... Args>
+    inline void add_actions(Args&&... acts) noexcept
+    {
+        (actions.push_back(std::forward<Args>(acts)), ...);
+    }
+
+    void run() final
+    {
+        reset_timer();
+        for(auto act : actions) {
+            switch(act) {
+            case ACTION::CREATE:
+                create(number);
+                break;
+            case ACTION::UPDATE:
+                update(number);
+                break;
+            case ACTION::MOST_COMMON:
+                most_common(number);
+                break;
+            case ACTION::PARALLEL:
+                parallel(number);
+                break;
+            case ACTION::FLAT_MAP:
+                flat_map(number);
+                break;
+            case ACTION::SKETCH:
+                sketch(number);
+                break;
+            case ACTION::DENSE:
+                dense(number);
+                break;
+            case ACTION::CONCURRENT:
+                concurrent(number);
+                break;
+            case ACTION::TOKENS:
+                tokens(number);
+                break;
+            }
+        }
+    }
+
+  private:
+    void print_name() final { std::cout << "Counter:\n" << std::endl; }
+    void print_ms() final { std::cout << cast_to<perf_clock::ms>() << " milliseconds.\n" << std::endl; }
+
+  private:
+    std::vector<int> random_elements(int num) const
+    {
+        std::vector<int> elements(static_cast<std::size_t>(num));
+        std::mt19937 gen(std::random_device{}());
+        std::uniform_int_distribution<> dist(0, distinct - 1);
+        for(auto& e : elements) {
+            e = dist(gen);
+        }
+        return elements;
+    }
+
+    void create(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " values (" << distinct << " distinct). Perfomance: ";
+        std::vector<int> elements = random_elements(num);
+
+        start_timer();
+        Counter<int> c(elements.begin(), elements.end());
+        auto result = c.most_common(1);
+        finish_timer();
+
+        if(result.empty()) {
+            std::cout << "Error: Counter.most_common(1) is empty" << std::endl;
+            print_line_separator();
+            return;
+        }
+        print_ms();
+        print_line_separator();
+    }
+
+    void update(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Update " << num << " values by batches of 100 values. Perfomance: ";
+        std::vector<int> elements = random_elements(num);
+        Counter<int> c(elements.begin(), elements.begin());
+
+        start_timer();
+        for(std::size_t i = 0; i + 100 <= elements.size(); i += 100) {
+            c.update(elements.begin() + static_cast<std::ptrdiff_t>(i), elements.begin() + static_cast<std::ptrdiff_t>(i + 100));
+        }
+        auto result = c.most_common();
+        finish_timer();
+
+        if(result.size() != c.size()) {
+            std::cout << "Error: Counter.most_common().size() != Counter.size()" << std::endl;
+            print_line_separator();
+            return;
+        }
+        print_ms();
+        print_line_separator();
+    }
+
+    void most_common(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Get 10 most common of " << num << " values (" << distinct << " distinct) after each update. "
+                  << "Wait for counting values ...";
+        std::vector<int> elements = random_elements(num);
+        Counter<int> c(elements.begin(), elements.end());
+        std::cout << "done.\nPerfomance: ";
+
+        start_timer();
+        for(int i = 0; i < 100; i++) {
+            c.update(elements.begin() + i, elements.begin() + i + 1);
+            if(c.most_common(10).size() != 10) {
+                std::cout << "Error: Counter.most_common(10).size() != 10" << std::endl;
+                print_line_separator();
+                return;
+            }
+        }
+        finish_timer();
+        print_ms();
+        print_line_separator();
+    }
+
+    void parallel(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " values (" << distinct << " distinct) in several threads.\n" << std::endl;
+        std::vector<int> elements = random_elements(num);
+        unsigned int max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for(unsigned int threads = 1; threads <= max_threads; threads *= 2) {
+            std::cout << threads << " thread(s). Perfomance: ";
+            start_timer();
+            Counter<int> c(elements.begin(), elements.end(), threads);
+            finish_timer();
+
+            if(c.size() == 0) {
+                std::cout << "Error: Counter.size() == 0" << std::endl;
+                print_line_separator();
+                return;
+            }
+            print_ms();
+        }
+        print_line_separator();
+    }
+
+    void flat_map(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " values (" << distinct << " distinct) using the map types.\n" << std::endl;
+        std::vector<int> elements = random_elements(num);
+
+        std::cout << "std::unordered_map. Perfomance: ";
+        start_timer();
+        Counter<int> c(elements.begin(), elements.end());
+        finish_timer();
+        print_ms();
+
+        std::cout << "FlatMap. Perfomance: ";
+        start_timer();
+        FlatCounter<int> flat(elements.begin(), elements.end());
+        finish_timer();
+        print_ms();
+
+        if(c.size() != flat.size()) {
+            std::cout << "Error: Counter.size() != FlatCounter.size()" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    void sketch(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " values (" << distinct << " distinct) using the Count-Min sketch "
+                  << "(epsilon = 0.0001, delta = 0.001).\n" << std::endl;
+        std::vector<int> elements = random_elements(num);
+
+        std::cout << "CountMinSketch. Perfomance: ";
+        start_timer();
+        CountMinSketch<int> s(0.0001, 0.001, elements.begin(), elements.end());
+        finish_timer();
+        print_ms();
+
+        std::cout << "CountMinSketch (conservative update). Perfomance: ";
+        start_timer();
+        CountMinSketch<int, true> conservative(0.0001, 0.001, elements.begin(), elements.end());
+        finish_timer();
+        print_ms();
+
+        if(s.estimate(elements.front()) == 0 || conservative.estimate(elements.front()) == 0) {
+            std::cout << "Error: CountMinSketch.estimate() == 0" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    void dense(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " bytes using the map types.\n" << std::endl;
+        std::vector<uint8_t> bytes(static_cast<std::size_t>(num));
+        std::mt19937 gen(std::random_device{}());
+        for(auto& b : bytes) {
+            // The repeated values are the worst case for one array.
+            b = static_cast<uint8_t>(gen() % 4 ? 0 : gen());
+        }
+
+        std::cout << "std::unordered_map. Perfomance: ";
+        start_timer();
+        Counter<uint8_t> c(bytes.begin(), bytes.end());
+        finish_timer();
+        print_ms();
+
+        std::cout << "FlatMap. Perfomance: ";
+        start_timer();
+        FlatCounter<uint8_t> flat(bytes.begin(), bytes.end());
+        finish_timer();
+        print_ms();
+
+        std::cout << "DenseMap. Perfomance: ";
+        start_timer();
+        DenseCounter<uint8_t> dense(bytes.begin(), bytes.end());
+        finish_timer();
+        print_ms();
+
+        if(c.most_common() != dense.most_common() || flat.most_common() != dense.most_common()) {
+            std::cout << "Error: Counter.most_common() != DenseCounter.most_common()" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    void concurrent(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Increment " << num << " values (" << distinct << " distinct) from several threads.\n" << std::endl;
+        std::vector<int> elements = random_elements(num);
+
+        for(unsigned int threads = 1; threads <= 64; threads *= 2) {
+            std::size_t part = elements.size() / threads;
+
+            std::cout << threads << " thread(s), Counter with one mutex. Perfomance: ";
+            Counter<int> c(elements.begin(), elements.begin());
+            std::mutex lock;
+            start_timer();
+            run_threads(threads, [&](std::size_t first) {
+                for(std::size_t i = first; i < first + part; i++) {
+                    std::lock_guard<std::mutex> guard(lock);
+                    c.update(elements.begin() + static_cast<std::ptrdiff_t>(i),
+                             elements.begin() + static_cast<std::ptrdiff_t>(i + 1));
+                }
+            }, part);
+            finish_timer();
+            print_ms();
+
+            std::cout << threads << " thread(s), ConcurrentCounter. Perfomance: ";
+            ConcurrentCounter<int> concurrent_counter;
+            start_timer();
+            run_threads(threads, [&](std::size_t first) {
+                for(std::size_t i = first; i < first + part; i++) {
+                    concurrent_counter.increment(elements[i]);
+                }
+            }, part);
+            finish_timer();
+            print_ms();
+
+            if(c.size() != concurrent_counter.size()) {
+                std::cout << "Error: Counter.size() != ConcurrentCounter.size()" << std::endl;
+                print_line_separator();
+                return;
+            }
+        }
+        print_line_separator();
+    }
+
+    void tokens(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Count " << num << " words (" << distinct << " distinct) of a text.\n" << std::endl;
+        std::string text;
+        for(int e : random_elements(num)) {
+            text += "word" + std::to_string(e) + " ";
+        }
+
+        std::cout << "Counter<std::string>. Perfomance: ";
+        start_timer();
+        std::istringstream stream(text);
+        std::istream_iterator<std::string> first(stream), last;
+        Counter<std::string> c(first, last);
+        finish_timer();
+        print_ms();
+
+        std::cout << "TokenCounter. Perfomance: ";
+        start_timer();
+        TokenCounter tokens;
+        tokens.count_text(text);
+        finish_timer();
+        print_ms();
+
+        if(c.size() != tokens.size()) {
+            std::cout << "Error: Counter.size() != TokenCounter.size()" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    template<typename F>
+    static void run_threads(unsigned int threads, F func, std::size_t part)
+    {
+        std::vector<std::thread> workers;
+        for(unsigned int t = 0; t < threads; t++) {
+            workers.emplace_back(func, part * t);
+        }
+        for(auto& worker : workers) {
+            worker.join();
+        }
+    }
+};
+
+#endif /* COUNTER_PERF_H */
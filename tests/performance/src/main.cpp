@@ -2,6 +2,7 @@
 #include "queue_perf.h"
 #include "sorted_list_perf.h"
 #include "bst_perf.h"
+#include "counter_perf.h"
 
 int main()
 {
@@ -15,12 +16,33 @@ int main()
     queue_perf.add_actions(QueuePerformance::INSERT, QueuePerformance::DELETE, QueuePerformance::CLEAR);
     queue_perf.run();
 
+    StackPerfomance stack_c_perf;
+    stack_c_perf.set_number(10'000'000);
+    stack_c_perf.add_actions(StackPerfomance::C_POOL);
+    stack_c_perf.run();
+
+    QueuePerformance queue_c_perf;
+    queue_c_perf.set_number(10'000'000);
+    queue_c_perf.add_actions(QueuePerformance::C_POOL);
+    queue_c_perf.run();
+
+    StackPerfomance stack_concurrent_perf;
+    stack_concurrent_perf.set_number(4'000'000);
+    stack_concurrent_perf.add_actions(StackPerfomance::C_CONCURRENT);
+    stack_concurrent_perf.run();
+
+    QueuePerformance queue_concurrent_perf;
+    queue_concurrent_perf.set_number(4'000'000);
+    queue_concurrent_perf.add_actions(QueuePerformance::C_CONCURRENT);
+    queue_concurrent_perf.run();
+
     SortedListPerfomance sorted_list_perf;
     sorted_list_perf.set_number(20000);
     sorted_list_perf.add_actions(SortedListPerfomance::INSERT,
                                  SortedListPerfomance::DELETE,
                                  SortedListPerfomance::CLEAR,
-                                 SortedListPerfomance::CLEAR);
+                                 SortedListPerfomance::CLEAR,
+                                 SortedListPerfomance::ERASE);
     sorted_list_perf.run();
 
     BinarySearchTreePerfomance binary_search_tree_perf;
@@ -31,5 +53,41 @@ int main()
                                         BinarySearchTreePerfomance::SEARCH);
     binary_search_tree_perf.run();
 
+    CounterPerfomance counter_perf;
+    counter_perf.set_number(1'000'000);
+    counter_perf.set_distinct(100'000);
+    counter_perf.add_actions(
+        CounterPerfomance::CREATE, CounterPerfomance::UPDATE, CounterPerfomance::MOST_COMMON, CounterPerfomance::TOKENS);
+    counter_perf.run();
+
+    CounterPerfomance counter_parallel_perf;
+    counter_parallel_perf.set_number(20'000'000);
+    counter_parallel_perf.set_distinct(1000);
+    counter_parallel_perf.add_actions(CounterPerfomance::PARALLEL);
+    counter_parallel_perf.run();
+
+    CounterPerfomance counter_low_cardinality_perf;
+    counter_low_cardinality_perf.set_number(10'000'000);
+    counter_low_cardinality_perf.set_distinct(100);
+    counter_low_cardinality_perf.add_actions(CounterPerfomance::FLAT_MAP);
+    counter_low_cardinality_perf.run();
+
+    CounterPerfomance counter_high_cardinality_perf;
+    counter_high_cardinality_perf.set_number(10'000'000);
+    counter_high_cardinality_perf.set_distinct(1'000'000);
+    counter_high_cardinality_perf.add_actions(CounterPerfomance::FLAT_MAP, CounterPerfomance::SKETCH);
+    counter_high_cardinality_perf.run();
+
+    CounterPerfomance counter_bytes_perf;
+    counter_bytes_perf.set_number(100'000'000);
+    counter_bytes_perf.add_actions(CounterPerfomance::DENSE);
+    counter_bytes_perf.run();
+
+    CounterPerfomance counter_concurrent_perf;
+    counter_concurrent_perf.set_number(4'194'304);
+    counter_concurrent_perf.set_distinct(100'000);
+    counter_concurrent_perf.add_actions(CounterPerfomance::CONCURRENT);
+    counter_concurrent_perf.run();
+
     return 0;
 }
@@ -2,8 +2,11 @@
 #define QUEUE_PERF_H
 
 #include "queue.h"
+#include "concurrent_queue.h"
 #include "performance.h"
+#include <atomic>
 #include <vector>
+#include <pthread.h>
 
 class QueuePerformance
     : public Perfomance
@@ -15,7 +18,9 @@ class QueuePerformance
     {
         INSERT,
         DELETE,
-        CLEAR
+        CLEAR,
+        C_POOL,
+        C_CONCURRENT
     };
 
   private:
@@ -45,6 +50,12 @@ class QueuePerformance
             case ACTION::CLEAR:
                 clear(number);
                 break;
+            case ACTION::C_POOL:
+                c_pool(number);
+                break;
+            case ACTION::C_CONCURRENT:
+                c_concurrent(number);
+                break;
             }
 	}
     }
@@ -128,6 +139,129 @@ class QueuePerformance
 	print_ms();
 	print_line_separator();
     }
+
+    void c_pool(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "pure_c::queue: enqueue and dequeue " << num << " values of 48 bytes, 1024 values in the queue.\n"
+                  << std::endl;
+        pure_c::queue* queues[] = {pure_c::queue_create(), pure_c::queue_create_with_pool()};
+        const char* names[] = {"queue_create (malloc)", "queue_create_with_pool"};
+        long sums[] = {0, 0};
+
+        for(std::size_t k = 0; k < 2; k++) {
+            pure_c::queue* q = queues[k];
+            long value[6] = {0, 0, 0, 0, 0, 0};
+            for(long i = 0; i < 1024; i++) {
+                value[0] = i;
+                pure_c::queue_enqueue(q, value, sizeof(value));
+            }
+            std::cout << names[k] << ". Perfomance: ";
+            start_timer();
+            for(long i = 0; i < num; i++) {
+                pure_c::queue_dequeue_into(q, value, sizeof(value));
+                sums[k] += value[0];
+                value[0] = i + 1024;
+                pure_c::queue_enqueue(q, value, sizeof(value));
+            }
+            finish_timer();
+            print_ms();
+            pure_c::queue_delete(q);
+        }
+
+        if(sums[0] != sums[1]) {
+            std::cout << "Error: the pooled queue returned other values" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    /**
+     * The queues, which are shared by the threads of the `c_concurrent` benchmark.
+     */
+    struct shared_queues
+    {
+        pure_c::queue* locked;                //! the queue, which is used under the mutex.
+        pthread_mutex_t lock;                 //! the mutex of the `locked` queue.
+        pure_c::concurrent_queue* concurrent; //! the thread-safe queue.
+        bool use_concurrent;                  //! which queue is used.
+        long per_thread;                      //! the number of values of each thread.
+        std::atomic<long> sum;                //! the sum of the removed values.
+    };
+
+    static void* produce(void* arg)
+    {
+        shared_queues* shared = static_cast<shared_queues*>(arg);
+        for(long i = 0; i < shared->per_thread; i++) {
+            if(shared->use_concurrent) {
+                pure_c::concurrent_queue_enqueue(shared->concurrent, &i, sizeof(i));
+            } else {
+                pthread_mutex_lock(&shared->lock);
+                pure_c::queue_enqueue(shared->locked, &i, sizeof(i));
+                pthread_mutex_unlock(&shared->lock);
+            }
+        }
+        return nullptr;
+    }
+
+    static void* consume(void* arg)
+    {
+        shared_queues* shared = static_cast<shared_queues*>(arg);
+        long value = 0, sum = 0;
+        for(long i = 0; i < shared->per_thread;) {
+            if(shared->use_concurrent) {
+                pure_c::concurrent_queue_wait_dequeue(shared->concurrent, &value, sizeof(value), -1);
+            } else {
+                pthread_mutex_lock(&shared->lock);
+                size_t length = pure_c::queue_dequeue_into(shared->locked, &value, sizeof(value));
+                pthread_mutex_unlock(&shared->lock);
+                if(!length) {
+                    continue;
+                }
+            }
+            sum += value;
+            i++;
+        }
+        shared->sum += sum;
+        return nullptr;
+    }
+
+    void c_concurrent(int num)
+    {
+        const int threads = 4;
+        print_line_separator();
+        print_name();
+        std::cout << "pure_c: " << threads / 2 << " producers and " << threads / 2 << " consumers (pthread) pass " << num
+                  << " values.\n"
+                  << std::endl;
+        const char* names[] = {"queue with pthread_mutex", "concurrent_queue"};
+        long sums[] = {0, 0};
+
+        for(std::size_t k = 0; k < 2; k++) {
+            shared_queues shared{pure_c::queue_create(), PTHREAD_MUTEX_INITIALIZER, pure_c::concurrent_queue_create(), k == 1,
+                                 num / (threads / 2), {0}};
+            pthread_t ids[threads];
+            std::cout << names[k] << ". Perfomance: ";
+            start_timer();
+            for(int t = 0; t < threads; t++) {
+                pthread_create(&ids[t], nullptr, t % 2 ? consume : produce, &shared);
+            }
+            for(int t = 0; t < threads; t++) {
+                pthread_join(ids[t], nullptr);
+            }
+            finish_timer();
+            print_ms();
+            sums[k] = shared.sum;
+            pure_c::queue_delete(shared.locked);
+            pure_c::concurrent_queue_delete(shared.concurrent);
+            pthread_mutex_destroy(&shared.lock);
+        }
+
+        if(sums[0] != sums[1]) {
+            std::cout << "Error: the concurrent queue returned other values" << std::endl;
+        }
+        print_line_separator();
+    }
 };
 
 #endif /* QUEUE_PERF_H */
@@ -18,7 +18,8 @@ class SortedListPerfomance
         INSERT,
         DELETE,
         CLEAR,
-        REVERSE
+        REVERSE,
+        ERASE
     };
 
   private:
@@ -51,6 +52,9 @@ class SortedListPerfomance
             case ACTION::REVERSE:
                 reverse(number);
                 break;
+            case ACTION::ERASE:
+                erase(number);
+                break;
             }
 	}
     }
@@ -172,6 +176,36 @@ class SortedListPerfomance
 	print_ms();
 	print_line_separator();
     }
+
+    void erase(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "Erase " << num << " values by handles. Wait for inserting values ...";
+        sorted_list<int> list;
+        std::vector<sorted_list<int>::handle> handles;
+
+        for(int i = 0; i < num; i++) {
+            handles.push_back(list.push_handle(i));
+        }
+
+        if(list.count() != static_cast<unsigned int>(num)) {
+            std::cout << "Error: sorted_list.count() != " << num << std::endl;
+            print_line_separator();
+            return;
+        }
+        std::cout << "done.\nPerfomance: ";
+
+        std::shuffle(handles.begin(), handles.end(), std::mt19937(std::random_device{}()));
+
+        start_timer();
+        for(const auto& h : handles) {
+            list.erase(h);
+        }
+        finish_timer();
+        print_ms();
+        print_line_separator();
+    }
 };
 
 #endif /* SORTED_LIST_PERF_H */
@@ -2,8 +2,11 @@
 #define STACK_PERF_H
 
 #include "stack.h"
+#include "concurrent_stack.h"
 #include "performance.h"
+#include <atomic>
 #include <vector>
+#include <pthread.h>
 
 class StackPerfomance
     : public Perfomance
@@ -14,7 +17,9 @@ class StackPerfomance
     enum ACTION
     {
         INSERT,
-        DELETE
+        DELETE,
+        C_POOL,
+        C_CONCURRENT
     };
 
   private:
@@ -41,6 +46,12 @@ class StackPerfomance
             case ACTION::DELETE:
                 remove(number);
                 break;
+            case ACTION::C_POOL:
+                c_pool(number);
+                break;
+            case ACTION::C_CONCURRENT:
+                c_concurrent(number);
+                break;
             }
 	}
     }
@@ -96,6 +107,123 @@ class StackPerfomance
 	print_ms();
 	print_line_separator();
     }
+
+    void c_pool(int num)
+    {
+        print_line_separator();
+        print_name();
+        std::cout << "pure_c::stack: push and pop " << num << " values of 48 bytes in batches of 1024 values.\n"
+                  << std::endl;
+        pure_c::stack* stacks[] = {pure_c::stack_create(), pure_c::stack_create_with_pool()};
+        const char* names[] = {"stack_create (malloc)", "stack_create_with_pool"};
+        long sums[] = {0, 0};
+
+        for(std::size_t k = 0; k < 2; k++) {
+            pure_c::stack* s = stacks[k];
+            long value[6] = {0, 0, 0, 0, 0, 0};
+            std::cout << names[k] << ". Perfomance: ";
+            start_timer();
+            for(long i = 0; i < num; i += 1024) {
+                for(long j = 0; j < 1024; j++) {
+                    value[0] = i + j;
+                    pure_c::stack_push(s, value, sizeof(value));
+                }
+                while(pure_c::stack_pop_into(s, value, sizeof(value))) {
+                    sums[k] += value[0];
+                }
+            }
+            finish_timer();
+            print_ms();
+            pure_c::stack_delete(s);
+        }
+
+        if(sums[0] != sums[1]) {
+            std::cout << "Error: the pooled stack returned other values" << std::endl;
+        }
+        print_line_separator();
+    }
+
+    /**
+     * The stacks, which are shared by the threads of the `c_concurrent` benchmark.
+     */
+    struct shared_stacks
+    {
+        pure_c::stack* locked;                //! the stack, which is used under the mutex.
+        pthread_mutex_t lock;                 //! the mutex of the `locked` stack.
+        pure_c::concurrent_stack* concurrent; //! the thread-safe stack.
+        bool use_concurrent;                  //! which stack is used.
+        long per_thread;                      //! the number of values of each thread.
+        std::atomic<long> sum;                //! the sum of the removed values.
+    };
+
+    /**
+     * Pushes the values and pops them in batches of 16 values.
+     */
+    static void* push_pop(void* arg)
+    {
+        shared_stacks* shared = static_cast<shared_stacks*>(arg);
+        long value = 0, sum = 0;
+        for(long i = 0; i < shared->per_thread; i++) {
+            value = i;
+            if(shared->use_concurrent) {
+                pure_c::concurrent_stack_push(shared->concurrent, &value, sizeof(value));
+            } else {
+                pthread_mutex_lock(&shared->lock);
+                pure_c::stack_push(shared->locked, &value, sizeof(value));
+                pthread_mutex_unlock(&shared->lock);
+            }
+            if(i % 16 != 15) {
+                continue;
+            }
+            for(int j = 0; j < 16; j++) {
+                if(shared->use_concurrent) {
+                    pure_c::concurrent_stack_pop_into(shared->concurrent, &value, sizeof(value));
+                } else {
+                    pthread_mutex_lock(&shared->lock);
+                    pure_c::stack_pop_into(shared->locked, &value, sizeof(value));
+                    pthread_mutex_unlock(&shared->lock);
+                }
+                sum += value;
+            }
+        }
+        shared->sum += sum;
+        return nullptr;
+    }
+
+    void c_concurrent(int num)
+    {
+        const int threads = 4;
+        print_line_separator();
+        print_name();
+        std::cout << "pure_c: " << threads << " threads (pthread) push and pop " << num << " values.\n" << std::endl;
+        const char* names[] = {"stack with pthread_mutex", "concurrent_stack"};
+        long sums[] = {0, 0};
+
+        for(std::size_t k = 0; k < 2; k++) {
+            shared_stacks shared{pure_c::stack_create(), PTHREAD_MUTEX_INITIALIZER, pure_c::concurrent_stack_create(), k == 1,
+                                 num / threads / 16 * 16, {0}};
+            pthread_t ids[threads];
+            std::cout << names[k] << ". Perfomance: ";
+            start_timer();
+            for(int t = 0; t < threads; t++) {
+                pthread_create(&ids[t], nullptr, push_pop, &shared);
+            }
+            for(int t = 0; t < threads; t++) {
+                pthread_join(ids[t], nullptr);
+            }
+            finish_timer();
+            print_ms();
+            sums[k] = shared.sum;
+            pure_c::stack_delete(shared.locked);
+            pure_c::concurrent_stack_delete(shared.concurrent);
+            pthread_mutex_destroy(&shared.lock);
+        }
+
+        if(sums[0] != sums[1]) {
+            std::cout << "Error: the concurrent stack returned other values" << std::endl;
+        }
+        print_line_separator();
+    }
 };
 
 #endif /* STACK_PERF_H */
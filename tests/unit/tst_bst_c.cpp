@@ -0,0 +1,106 @@
+#include <catch.hpp>
+#include "bst.h"
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <vector>
+
+using namespace pure_c;
+
+namespace
+{
+/**
+ * The record, which is ordered by the key.
+ */
+struct record
+{
+    int key;
+    char name[36];
+};
+
+int compare_int(const void* a, const void* b)
+{
+    int x = *static_cast<const int*>(a), y = *static_cast<const int*>(b);
+    return (x > y) - (x < y);
+}
+
+int compare_record(const void* a, const void* b)
+{
+    return compare_int(&static_cast<const record*>(a)->key, &static_cast<const record*>(b)->key);
+}
+} // namespace
+
+TEST_CASE("[bst] Testing the ordered set in C code.", "[bst_c]")
+{
+    SECTION("Testing the creation.")
+    {
+        REQUIRE(c_bst_create(0, compare_int) == NULL);
+        REQUIRE(c_bst_create(257, compare_int) == NULL);
+        c_bst* b = c_bst_create(sizeof(int), compare_int);
+        REQUIRE(b != NULL);
+        REQUIRE(c_bst_count(b) == 0);
+        int value = 0;
+        REQUIRE(c_bst_min(b, &value) == 0);
+        REQUIRE(c_bst_max(b, &value) == 0);
+        REQUIRE(c_bst_remove(b, &value) == 0);
+        c_bst_delete(b);
+    }
+    SECTION("Testing the insertion, search and removing.")
+    {
+        c_bst* b = c_bst_create(sizeof(int), compare_int);
+        std::set<int> expected;
+        for(int i = 0; i < 200; i++) {
+            int value = (i * 37) % 101 - 50;
+            REQUIRE(c_bst_insert(b, &value) == (expected.insert(value).second ? 1 : 0));
+        }
+        REQUIRE(c_bst_count(b) == expected.size());
+        int value = 0;
+        REQUIRE(c_bst_min(b, &value) == 1);
+        REQUIRE(value == *expected.begin());
+        REQUIRE(c_bst_max(b, &value) == 1);
+        REQUIRE(value == *expected.rbegin());
+        for(int i = -60; i < 60; i++) {
+            REQUIRE(c_bst_find(b, &i) == static_cast<int>(expected.count(i)));
+        }
+        for(int i = -50; i < 50; i += 3) {
+            REQUIRE(c_bst_remove(b, &i) == static_cast<int>(expected.erase(i)));
+            REQUIRE(c_bst_find(b, &i) == 0);
+        }
+        std::vector<int> elements(expected.size());
+        REQUIRE(c_bst_to_array(b, elements.data(), elements.size()) == expected.size());
+        REQUIRE(std::equal(elements.begin(), elements.end(), expected.begin()));
+        REQUIRE(c_bst_to_array(b, elements.data(), 5) == 5);
+
+        c_bst_clear(b);
+        REQUIRE(c_bst_count(b) == 0);
+        c_bst_delete(b);
+    }
+    SECTION("Testing the bulk insertion.")
+    {
+        c_bst* b = c_bst_create(sizeof(record), compare_record);
+        std::vector<record> records(10000);
+        for(int i = 0; i < 10000; i++) {
+            // the sorted input with the duplicates.
+            records[static_cast<std::size_t>(i)].key = i / 2;
+            std::strcpy(records[static_cast<std::size_t>(i)].name, "record");
+        }
+        REQUIRE(c_bst_insert_n(b, records.data(), records.size()) == 5000);
+        REQUIRE(c_bst_insert_n(b, records.data(), 10) == 0);
+        REQUIRE(c_bst_count(b) == 5000);
+        record r{4999, ""};
+        REQUIRE(c_bst_find(b, &r) == 1);
+        REQUIRE(c_bst_max(b, &r) == 1);
+        REQUIRE(r.key == 4999);
+        REQUIRE(std::string(r.name) == "record");
+        c_bst_delete(b);
+    }
+    SECTION("Testing the comparison of the bytes.")
+    {
+        c_bst* b = c_bst_create(4, NULL);
+        REQUIRE(c_bst_insert_n(b, "abcdabcdefgh", 3) == 2);
+        char min[4];
+        REQUIRE(c_bst_min(b, min) == 1);
+        REQUIRE(std::memcmp(min, "abcd", 4) == 0);
+        c_bst_delete(b);
+    }
+}
@@ -0,0 +1,50 @@
+#include <catch.hpp>
+#include "concurrent_counter.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("[ConcurrentCounter] Testing the `ConcurrentCounter` class.", "[concurrent counter]")
+{
+    SECTION("Testing the counting in one thread.")
+    {
+        std::vector<std::string> v = {"v1", "v2", "v2", "v3", "v3", "v3"};
+        ConcurrentCounter<std::string> c(v.begin(), v.end(), 5);
+        REQUIRE(c.shards() == 8);
+        REQUIRE(c.size() == 3);
+        REQUIRE(c.count("v3") == 3);
+        REQUIRE(c.count("v4") == 0);
+
+        c.increment("v1", 5);
+        auto snapshot = c.snapshot();
+        REQUIRE(snapshot.most_common() == Counter<std::string>::vector_t{{"v1", 6}, {"v3", 3}, {"v2", 2}});
+
+        c.clear();
+        REQUIRE(c.size() == 0);
+        REQUIRE(snapshot.size() == 3);
+    }
+    SECTION("Testing the counting in several threads.")
+    {
+        ConcurrentCounter<int> c;
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 8; t++) {
+            threads.emplace_back([&c, t]() {
+                for(int i = 0; i < 10000; i++) {
+                    c.increment(i % 100);
+                    c.increment(1000 + t);
+                }
+            });
+        }
+        for(auto& t : threads) {
+            t.join();
+        }
+        REQUIRE(c.size() == 108);
+        auto result = c.snapshot().most_common();
+        REQUIRE(result.size() == 108);
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(c.count(i) == 800);
+        }
+        REQUIRE(result.at(0) == std::make_pair(1000, 10000u));
+    }
+}
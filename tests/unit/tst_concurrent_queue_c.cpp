@@ -0,0 +1,103 @@
+#include <catch.hpp>
+#include "concurrent_queue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace pure_c;
+
+namespace
+{
+/**
+ * The element, which is passed between the threads.
+ */
+struct message
+{
+    int producer;
+    int number;
+};
+} // namespace
+
+TEST_CASE("[concurrent queue] Testing the thread-safe queue in C code.", "[concurrent_queue_c]")
+{
+    SECTION("Testing the queue in one thread.")
+    {
+        concurrent_queue* q = concurrent_queue_create();
+        int value = 0;
+        REQUIRE(concurrent_queue_dequeue_into(q, &value, sizeof(value)) == 0);
+        REQUIRE(concurrent_queue_wait_dequeue(q, &value, sizeof(value), 10) == 0);
+        // the empty element is not inserted: `0` means the empty queue.
+        REQUIRE(concurrent_queue_enqueue(q, &value, 0) == 0);
+        REQUIRE(concurrent_queue_count(q) == 0);
+        REQUIRE(concurrent_queue_wait_dequeue(q, &value, sizeof(value), 10) == 0);
+        for(int i = 0; i < 10; i++) {
+            REQUIRE(concurrent_queue_enqueue(q, &i, sizeof(i)) == 1);
+        }
+        REQUIRE(concurrent_queue_count(q) == 10);
+        short small = 0;
+        REQUIRE(concurrent_queue_dequeue_into(q, &small, sizeof(small)) == sizeof(int));
+        for(int i = 0; i < 5; i++) {
+            REQUIRE(concurrent_queue_wait_dequeue(q, &value, sizeof(value), -1) == sizeof(int));
+            REQUIRE(value == i);
+        }
+        REQUIRE(concurrent_queue_count(q) == 5);
+        // the rest of the elements are freed by `concurrent_queue_delete`.
+        concurrent_queue_delete(q);
+    }
+    SECTION("Testing the waiting consumer.")
+    {
+        concurrent_queue* q = concurrent_queue_create();
+        int value = 0;
+        std::thread producer([q]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            int v = 42;
+            concurrent_queue_enqueue(q, &v, sizeof(v));
+        });
+        REQUIRE(concurrent_queue_wait_dequeue(q, &value, sizeof(value), -1) == sizeof(int));
+        REQUIRE(value == 42);
+        producer.join();
+        concurrent_queue_delete(q);
+    }
+    SECTION("Testing several producers and consumers.")
+    {
+        concurrent_queue* q = concurrent_queue_create();
+        const int producers = 4, consumers = 4, number = 50000;
+        std::atomic<long> sum{0};
+        std::atomic<int> disorders{0};
+        std::vector<std::thread> threads;
+        for(int c = 0; c < consumers; c++) {
+            threads.emplace_back([&]() {
+                std::vector<int> last(producers, -1);
+                message m{0, 0};
+                for(int i = 0; i < producers * number / consumers; i++) {
+                    if(concurrent_queue_wait_dequeue(q, &m, sizeof(m), 10000) != sizeof(m)) {
+                        disorders++;
+                        return;
+                    }
+                    // the elements of each producer are removed in its order.
+                    if(m.number <= last[static_cast<std::size_t>(m.producer)]) {
+                        disorders++;
+                    }
+                    last[static_cast<std::size_t>(m.producer)] = m.number;
+                    sum += m.number;
+                }
+            });
+        }
+        for(int p = 0; p < producers; p++) {
+            threads.emplace_back([q, p]() {
+                for(int i = 0; i < number; i++) {
+                    message m{p, i};
+                    concurrent_queue_enqueue(q, &m, sizeof(m));
+                }
+            });
+        }
+        for(auto& t : threads) {
+            t.join();
+        }
+        REQUIRE(disorders == 0);
+        REQUIRE(sum == static_cast<long>(producers) * number * (number - 1) / 2);
+        REQUIRE(concurrent_queue_count(q) == 0);
+        concurrent_queue_delete(q);
+    }
+}
@@ -0,0 +1,63 @@
+#include <catch.hpp>
+#include "concurrent_stack.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace pure_c;
+
+TEST_CASE("[concurrent stack] Testing the thread-safe stack in C code.", "[concurrent_stack_c]")
+{
+    SECTION("Testing the stack in one thread.")
+    {
+        concurrent_stack* s = concurrent_stack_create();
+        int value = 0;
+        REQUIRE(concurrent_stack_pop_into(s, &value, sizeof(value)) == 0);
+        // the empty element is not inserted: `0` means the empty stack.
+        REQUIRE(concurrent_stack_push(s, &value, 0) == 0);
+        REQUIRE(concurrent_stack_count(s) == 0);
+        for(int i = 0; i < 10; i++) {
+            REQUIRE(concurrent_stack_push(s, &i, sizeof(i)) == 1);
+        }
+        REQUIRE(concurrent_stack_count(s) == 10);
+        short small = 0;
+        REQUIRE(concurrent_stack_pop_into(s, &small, sizeof(small)) == sizeof(int));
+        for(int i = 9; i >= 5; i--) {
+            REQUIRE(concurrent_stack_pop_into(s, &value, sizeof(value)) == sizeof(int));
+            REQUIRE(value == i);
+        }
+        REQUIRE(concurrent_stack_count(s) == 5);
+        concurrent_stack_delete(s);
+    }
+    SECTION("Testing several threads, which push and pop.")
+    {
+        concurrent_stack* s = concurrent_stack_create();
+        const int threads_number = 8, number = 50000;
+        std::atomic<long> pushed{0}, popped{0};
+        std::vector<std::thread> threads;
+        for(int t = 0; t < threads_number; t++) {
+            threads.emplace_back([&, t]() {
+                long value = 0;
+                for(int i = 0; i < number; i++) {
+                    value = t * number + i;
+                    concurrent_stack_push(s, &value, sizeof(value));
+                    pushed += value;
+                    // each thread pops after every second push, so the nodes are freed, while other threads pop.
+                    if(i % 2 && concurrent_stack_pop_into(s, &value, sizeof(value)) == sizeof(value)) {
+                        popped += value;
+                    }
+                }
+            });
+        }
+        for(auto& t : threads) {
+            t.join();
+        }
+        long value = 0;
+        while(concurrent_stack_pop_into(s, &value, sizeof(value)) == sizeof(value)) {
+            popped += value;
+        }
+        REQUIRE(pushed == popped);
+        REQUIRE(concurrent_stack_count(s) == 0);
+        concurrent_stack_delete(s);
+    }
+}
@@ -0,0 +1,84 @@
+#include <catch.hpp>
+#include "count_min_sketch.h"
+#include "counter.h"
+
+#include <string>
+#include <random>
+
+TEST_CASE("[CountMinSketch] Testing the initialization of the `CountMinSketch` class.", "[count min sketch]")
+{
+    SECTION("Testing the sizes.")
+    {
+        CountMinSketch<int> s(0.01, 0.01);
+        REQUIRE(s.width() == 512);
+        REQUIRE(s.depth() == 5);
+        REQUIRE(s.total() == 0);
+        REQUIRE(s.estimate(1) == 0);
+
+        REQUIRE_THROWS_AS(CountMinSketch<int>(0.0, 0.01), std::invalid_argument);
+        REQUIRE_THROWS_AS(CountMinSketch<int>(0.01, 1.0), std::invalid_argument);
+    }
+    SECTION("Testing the constructor with the sequence.")
+    {
+        std::vector<std::string> v = {"v1", "v2", "v2", "v3", "v3", "v3"};
+        CountMinSketch<std::string> s(0.01, 0.01, v.begin(), v.end());
+        REQUIRE(s.total() == 6);
+        REQUIRE(s.estimate("v1") == 1);
+        REQUIRE(s.estimate("v2") == 2);
+        REQUIRE(s.estimate("v3") == 3);
+        REQUIRE(s.estimate("v4") == 0);
+
+        s.clear();
+        REQUIRE(s.total() == 0);
+        REQUIRE(s.estimate("v3") == 0);
+    }
+}
+
+template<bool Conservative>
+static void check_error_bounds()
+{
+    std::vector<int> v;
+    std::mt19937 gen(11);
+    for(int i = 0; i < 50000; i++) {
+        v.push_back(static_cast<int>(gen() % 5000));
+    }
+    Counter<int> exact(v.begin(), v.end());
+    CountMinSketch<int, Conservative> s(0.001, 0.001, v.begin(), v.end());
+
+    REQUIRE(s.total() == v.size());
+    auto limit = static_cast<unsigned int>(0.001 * static_cast<double>(s.total()));
+    std::size_t wrong = 0;
+    for(const auto& p : exact.most_common()) {
+        unsigned int estimated = s.estimate(p.first);
+        REQUIRE(estimated >= p.second);
+        if(estimated > p.second + limit) {
+            wrong++;
+        }
+    }
+    REQUIRE(wrong <= exact.size() / 100);
+}
+
+TEST_CASE("[CountMinSketch] Testing the error bounds.", "[count min sketch]")
+{
+    SECTION("Testing the default update.") { check_error_bounds<false>(); }
+    SECTION("Testing the conservative update.") { check_error_bounds<true>(); }
+}
+
+TEST_CASE("[CountMinSketch] Testing the `merge` method.", "[count min sketch]")
+{
+    SECTION("Testing the merge of two sketches.")
+    {
+        std::vector<int> v1 = {1, 2, 2, 3, 3, 3};
+        std::vector<int> v2 = {3, 4, 4, 1};
+        CountMinSketch<int> s1(0.01, 0.01, v1.begin(), v1.end());
+        CountMinSketch<int> s2(0.01, 0.01, v2.begin(), v2.end());
+        s1.merge(s2);
+        REQUIRE(s1.total() == 10);
+        REQUIRE(s1.estimate(1) == 2);
+        REQUIRE(s1.estimate(3) == 4);
+        REQUIRE(s1.estimate(4) == 2);
+
+        CountMinSketch<int> s3(0.1, 0.01);
+        REQUIRE_THROWS_AS(s1.merge(s3), std::invalid_argument);
+    }
+}
@@ -4,6 +4,9 @@
 #include <string>
 #include <list>
 #include <set>
+#include <random>
+#include <cstdint>
+#include <stdexcept>
 
 /*
  * Common testing the `Counter` class.
@@ -179,3 +182,276 @@ TEST_CASE("[Counter] The `Counter` class.", "[counter]") {
 		}
 	}
 }
+
+/*
+ * Testing the lazy ordering of the `Counter` class.
+ */
+TEST_CASE("[Counter] The lazy ordering of the `Counter` class.", "[counter]") {
+	SECTION("Testing the `update` function with small batches.") {
+		std::vector<int> v = {1, 2, 3, 3, 2, 3};
+		Counter<int> c(v.begin(), v.begin());
+		REQUIRE(c.size() == 0);
+		REQUIRE(c.most_common().empty());
+
+		for (std::size_t i = 0; i < v.size(); i += 2) {
+			c.update(v.begin() + static_cast<std::ptrdiff_t>(i), v.begin() + static_cast<std::ptrdiff_t>(i + 2));
+		}
+		REQUIRE(c.size() == 3);
+		Counter<int>::vector_t top = c.most_common(1);
+		REQUIRE(top.size() == 1);
+		REQUIRE(top.at(0).first == 3);
+		REQUIRE(top.at(0).second == 3);
+
+		std::vector<int> v2 = {1, 1, 1, 1};
+		c.update(v2.begin(), v2.end());
+		top = c.most_common(2);
+		REQUIRE(top.at(0).first == 1);
+		REQUIRE(top.at(0).second == 5);
+		REQUIRE(top.at(1).first == 3);
+
+		Counter<int>::vector_t all = c.most_common();
+		REQUIRE(all.size() == 3);
+		REQUIRE(all.at(0).first == 1);
+		REQUIRE(all.at(1).first == 3);
+		REQUIRE(all.at(2).first == 2);
+		REQUIRE(all.at(2).second == 2);
+
+		std::size_t i = 0;
+		for (auto it = c.begin(); it != c.end(); ++it) {
+			REQUIRE(it->first == all.at(i).first);
+			i++;
+		}
+		REQUIRE(i == 3);
+	}
+	SECTION("Testing the partial sorting.") {
+		std::vector<int> v;
+		for (int i = 0; i < 100; i++) {
+			for (int j = 0; j <= i; j++) {
+				v.push_back(i);
+			}
+		}
+		Counter<int> c(v.begin(), v.end());
+		for (int n = 1; n <= 100; n *= 3) {
+			Counter<int>::vector_t top = c.most_common(n);
+			REQUIRE(top.size() == static_cast<std::size_t>(n));
+			for (int k = 0; k < n; k++) {
+				REQUIRE(top.at(static_cast<std::size_t>(k)).first == 99 - k);
+			}
+		}
+		REQUIRE(c.most_common(200).size() == 100);
+	}
+}
+
+/*
+ * The key, the hash of which throws for the negative values.
+ */
+struct throwing_key {
+	int value;
+	bool operator==(const throwing_key& other) const { return value == other.value; }
+	bool operator<(const throwing_key& other) const { return value < other.value; }
+};
+
+namespace std {
+template<>
+struct hash<throwing_key> {
+	std::size_t operator()(const throwing_key& key) const {
+		if (key.value < 0) {
+			throw std::runtime_error("Error: the negative key.");
+		}
+		return std::hash<int>{}(key.value);
+	}
+};
+} // namespace std
+
+/*
+ * Testing the parallel constructor of the `Counter` class.
+ */
+TEST_CASE("[Counter] The parallel constructor of the `Counter` class.", "[counter]") {
+	SECTION("Testing the parallel counting.") {
+		std::vector<int> v(Counter<int>::parallel_threshold * 5 + 7);
+		for (std::size_t i = 0; i < v.size(); i++) {
+			v[i] = static_cast<int>((i * 7919) % 1000);
+		}
+		Counter<int> serial(v.begin(), v.end());
+		Counter<int>::vector_t expected = serial.most_common();
+
+		for (unsigned int threads : {0u, 1u, 2u, 3u, 8u}) {
+			Counter<int> c(v.begin(), v.end(), threads);
+			REQUIRE(c.size() == 1000);
+			Counter<int>::vector_t result = c.most_common();
+			REQUIRE(result == expected);
+		}
+	}
+	SECTION("Testing the serial fallback.") {
+		std::vector<std::string> v = {"v1", "v2", "v2", "v3", "v3", "v3"};
+		Counter<std::string> c(v.begin(), v.end(), 4);
+		REQUIRE(c.size() == 3);
+		REQUIRE(c.most_common(1).at(0).first == "v3");
+
+		Counter<std::string> empty(v.begin(), v.begin(), 4);
+		REQUIRE(empty.size() == 0);
+	}
+	SECTION("Testing the exception of the current thread.") {
+		// the last part is counted by the current thread, the workers are joined before the exception.
+		std::vector<throwing_key> v(Counter<int>::parallel_threshold * 3, throwing_key{1});
+		v.back().value = -1;
+		REQUIRE_THROWS_AS(Counter<throwing_key>(v.begin(), v.end(), 3), std::runtime_error);
+		v.back().value = 2;
+		v.front().value = -1;
+		REQUIRE_THROWS_AS(Counter<throwing_key>(v.begin(), v.end(), 3), std::runtime_error);
+	}
+}
+
+/*
+ * Testing the `Counter` class with the `FlatMap` class.
+ */
+TEST_CASE("[Counter] The `FlatCounter` class.", "[counter]") {
+	SECTION("Testing the `FlatCounter` class.") {
+		std::vector<std::string> v = {
+			"v1", "v2", "v3", "v4", "v5",
+			"v6", "v7", "v7", "v7", "v7",
+			"v7", "v6", "v8", "v6", "v1",
+			"v9", "v9", "v11", "v4", "v2",
+			"v8", "v11", "v2", "v1", "v5",
+			"v3", "v1", "v2", "v1", "v5",
+			"v8", "v1", "v3", "v5", "v1",
+			"v8", "v1", "v1", "v4", "v1",
+			"v1", "v1", "v1", "v2", "v2"
+		};
+
+		Counter<std::string> expected(v.begin(), v.end());
+		FlatCounter<std::string> c(v.begin(), v.end());
+		REQUIRE(c.size() == 10);
+		REQUIRE(c.most_common() == expected.most_common());
+
+		c.update(v.begin(), v.begin() + 3);
+		expected.update(v.begin(), v.begin() + 3);
+		REQUIRE(c.most_common(4) == expected.most_common(4));
+
+		FlatCounter<std::string>::map_t m = FlatCounter<std::string>::map(v.begin(), v.end());
+		REQUIRE(m.size() == 10);
+		REQUIRE(m["v1"] == 13);
+
+		auto vec = FlatCounter<std::string>::count<std::vector>(v.begin(), v.end());
+		REQUIRE(vec.at(0).first == "v1");
+		REQUIRE(vec.at(9).first == "v9");
+
+		std::vector<int> numbers(Counter<int>::parallel_threshold * 3);
+		for (std::size_t i = 0; i < numbers.size(); i++) {
+			numbers[i] = static_cast<int>(i % 777);
+		}
+		FlatCounter<int, false> parallel(numbers.begin(), numbers.end(), 3);
+		REQUIRE(parallel.size() == 777);
+		REQUIRE(parallel.most_common(1).at(0).second == numbers.size() / 777 + 1);
+	}
+	SECTION("Testing the merge with itself.") {
+		// 14 keys fill the table, the merge must not rehash the map, which it iterates.
+		std::vector<int> numbers(14);
+		for (int i = 0; i < 14; i++) {
+			numbers[static_cast<std::size_t>(i)] = i;
+		}
+		FlatCounter<int> c(numbers.begin(), numbers.end());
+		c.merge(c);
+		REQUIRE(c.size() == 14);
+		for (const auto& p : c.most_common()) {
+			REQUIRE(p.second == 2);
+		}
+	}
+}
+
+/*
+ * Testing the `Counter` class with the `DenseMap` class.
+ */
+TEST_CASE("[Counter] The `DenseCounter` class.", "[counter]") {
+	SECTION("Testing the `DenseCounter` class.") {
+		std::string text = "the quick brown fox jumps over the lazy dog";
+		Counter<char> expected(text.begin(), text.end());
+		DenseCounter<char> c(text.begin(), text.end());
+		REQUIRE(c.size() == expected.size());
+		REQUIRE(c.most_common() == expected.most_common());
+
+		c.update(text.begin(), text.begin() + 10);
+		expected.update(text.begin(), text.begin() + 10);
+		REQUIRE(c.most_common(3) == expected.most_common(3));
+
+		auto vec = DenseCounter<char>::count<std::vector>(text.begin(), text.end());
+		REQUIRE(vec.at(0) == std::make_pair(' ', 8u));
+	}
+	SECTION("Testing the large sequences.") {
+		std::mt19937 gen(5);
+		std::vector<uint8_t> bytes(1 << 16);
+		for (auto& b : bytes) {
+			b = static_cast<uint8_t>(gen() % 7 == 0 ? 42 : gen());
+		}
+		Counter<uint8_t> expected(bytes.begin(), bytes.end());
+		DenseCounter<uint8_t> c(bytes.begin(), bytes.end());
+		REQUIRE(c.most_common() == expected.most_common());
+		DenseCounter<uint8_t> parallel(bytes.begin(), bytes.end(), 3);
+		REQUIRE(parallel.most_common() == expected.most_common());
+
+		std::vector<int16_t> shorts(1 << 19);
+		for (auto& s : shorts) {
+			s = static_cast<int16_t>(static_cast<int>(gen() % 2001) - 1000);
+		}
+		Counter<int16_t> expected_shorts(shorts.begin(), shorts.end());
+		DenseCounter<int16_t> c_shorts(shorts.begin(), shorts.end());
+		REQUIRE(c_shorts.size() == 2001);
+		REQUIRE(c_shorts.most_common() == expected_shorts.most_common());
+	}
+}
+
+/*
+ * Testing the arithmetic of the `Counter` class.
+ */
+template<typename C>
+static void check_arithmetic()
+{
+	std::string a = "aaabbc";
+	std::string b = "abbbbd";
+	C ca(a.begin(), a.end());
+	C cb(b.begin(), b.end());
+
+	using vector_t = typename C::vector_t;
+	REQUIRE((ca + cb).most_common() == vector_t{{'b', 6}, {'a', 4}, {'c', 1}, {'d', 1}});
+	REQUIRE((ca - cb).most_common() == vector_t{{'a', 2}, {'c', 1}});
+	REQUIRE((cb - ca).most_common() == vector_t{{'b', 2}, {'d', 1}});
+	REQUIRE((ca & cb).most_common() == vector_t{{'b', 2}, {'a', 1}});
+	REQUIRE((ca | cb).most_common() == vector_t{{'b', 4}, {'a', 3}, {'c', 1}, {'d', 1}});
+	REQUIRE(ca.most_common() == vector_t{{'a', 3}, {'b', 2}, {'c', 1}});
+
+	REQUIRE(ca.most_common(1) == vector_t{{'a', 3}});
+	ca.merge(cb).merge(cb);
+	REQUIRE(ca.most_common() == vector_t{{'b', 10}, {'a', 5}, {'d', 2}, {'c', 1}});
+	ca.subtract(cb);
+	REQUIRE(ca.size() == 4);
+	ca.subtract(cb);
+	REQUIRE(ca.most_common() == vector_t{{'a', 3}, {'b', 2}, {'c', 1}});
+	ca.subtract(ca + cb);
+	REQUIRE(ca.size() == 0);
+	REQUIRE(ca.most_common().empty());
+
+	// the counter with itself has the doubled numbers.
+	C cd(a.begin(), a.end());
+	REQUIRE((cd + cd).most_common() == vector_t{{'a', 6}, {'b', 4}, {'c', 2}});
+	cd.merge(cd);
+	REQUIRE(cd.most_common() == vector_t{{'a', 6}, {'b', 4}, {'c', 2}});
+
+	// the counter without itself is empty.
+	cb.subtract(cb);
+	REQUIRE(cb.size() == 0);
+	REQUIRE(cb.most_common().empty());
+	cb.merge(C(b.begin(), b.end()));
+	REQUIRE(cb.most_common(1) == vector_t{{'b', 4}});
+}
+
+TEST_CASE("[Counter] The arithmetic of the `Counter` class.", "[counter]") {
+	SECTION("Testing the `Counter` class.") {
+		check_arithmetic<Counter<char>>();
+	}
+	SECTION("Testing the `FlatCounter` class.") {
+		check_arithmetic<FlatCounter<char>>();
+	}
+	SECTION("Testing the `DenseCounter` class.") {
+		check_arithmetic<DenseCounter<char>>();
+	}
+}
@@ -0,0 +1,91 @@
+#include <catch.hpp>
+#include "counter.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace pure_c;
+
+namespace
+{
+/**
+ * The fixed-size word.
+ */
+struct word
+{
+    char text[16];
+};
+
+std::size_t hash_word(const void* w)
+{
+    return std::hash<std::string>()(static_cast<const word*>(w)->text);
+}
+
+int compare_word(const void* a, const void* b)
+{
+    return std::strcmp(static_cast<const word*>(a)->text, static_cast<const word*>(b)->text);
+}
+
+word make_word(const char* text)
+{
+    word w{};
+    std::strncpy(w.text, text, sizeof(w.text) - 1);
+    return w;
+}
+} // namespace
+
+TEST_CASE("[counter] Testing the counter in C code.", "[counter_c]")
+{
+    SECTION("Testing the creation.")
+    {
+        REQUIRE(c_counter_create(0, NULL, NULL) == NULL);
+        c_counter* c = c_counter_create(sizeof(int), NULL, NULL);
+        REQUIRE(c != NULL);
+        REQUIRE(c_counter_size(c) == 0);
+        int value = 0;
+        REQUIRE(c_counter_most_common(c, 10, &value, NULL) == 0);
+        c_counter_delete(c);
+    }
+    SECTION("Testing the counting of the words.")
+    {
+        c_counter* c = c_counter_create(sizeof(word), hash_word, compare_word);
+        const char* text[] = {"a", "b", "c", "a", "c", "d", "a", "a", "b", "c"};
+        std::vector<word> words;
+        for(const char* t : text) {
+            words.push_back(make_word(t));
+        }
+        c_counter_add_n(c, words.data(), words.size());
+        word e = make_word("e");
+        c_counter_add(c, &e);
+        REQUIRE(c_counter_size(c) == 5);
+
+        word common[5];
+        unsigned int counts[5];
+        REQUIRE(c_counter_most_common(c, 10, common, counts) == 5);
+        const char* expected[] = {"a", "c", "b", "d", "e"};
+        const unsigned int expected_counts[] = {4, 3, 2, 1, 1};
+        for(int i = 0; i < 5; i++) {
+            REQUIRE(std::string(common[i].text) == expected[i]);
+            REQUIRE(counts[i] == expected_counts[i]);
+        }
+        REQUIRE(c_counter_most_common(c, 2, common, NULL) == 2);
+        REQUIRE(std::string(common[1].text) == "c");
+        c_counter_delete(c);
+    }
+    SECTION("Testing the counting of the bytes.")
+    {
+        c_counter* c = c_counter_create(sizeof(long), NULL, NULL);
+        std::vector<long> values;
+        for(long i = 0; i < 10000; i++) {
+            values.push_back(i % 100 < 10 ? 7 : i % 100);
+        }
+        c_counter_add_n(c, values.data(), values.size());
+        REQUIRE(c_counter_size(c) == 91);
+        long value = 0;
+        unsigned int count = 0;
+        REQUIRE(c_counter_most_common(c, 1, &value, &count) == 1);
+        REQUIRE(value == 7);
+        REQUIRE(count == 1000);
+        c_counter_delete(c);
+    }
+}
@@ -0,0 +1,49 @@
+#include <catch.hpp>
+#include "dense_map.h"
+
+#include <cstdint>
+#include <map>
+#include <random>
+
+TEST_CASE("[DenseMap] Testing the dense map.", "[dense map]")
+{
+    SECTION("Testing the operator `[]` and the iterators.")
+    {
+        DenseMap<char> map;
+        REQUIRE(map.empty());
+        map['a']++;
+        map['b'] += 2;
+        map[static_cast<char>(-1)] += 3;
+        REQUIRE(map.size() == 3);
+        REQUIRE(map.count('a') == 1);
+        REQUIRE(map.count('c') == 0);
+
+        std::map<char, unsigned int> pairs(map.begin(), map.end());
+        REQUIRE(pairs == std::map<char, unsigned int>{{'a', 1}, {'b', 2}, {static_cast<char>(-1), 3}});
+
+        REQUIRE(map.erase('a') == 1);
+        REQUIRE(map.erase('a') == 0);
+        REQUIRE(map.size() == 2);
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.begin() == map.end());
+    }
+    SECTION("Testing the `add` function.")
+    {
+        std::mt19937 gen(3);
+        std::vector<uint16_t> keys(DenseMap<uint16_t>::range * 5 + 3);
+        for(auto& k : keys) {
+            k = static_cast<uint16_t>(gen() % 1000);
+        }
+        DenseMap<uint16_t> added;
+        DenseMap<uint16_t> expected;
+        added.add(keys.begin(), keys.end());
+        for(auto k : keys) {
+            expected[k]++;
+        }
+        REQUIRE(added.size() == expected.size());
+        for(uint16_t k = 0; k < 1000; k++) {
+            REQUIRE(added[k] == expected[k]);
+        }
+    }
+}
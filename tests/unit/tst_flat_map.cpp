@@ -0,0 +1,154 @@
+#include <catch.hpp>
+#include "flat_map.h"
+
+#include <string>
+#include <unordered_map>
+#include <random>
+
+TEST_CASE("[FlatMap] Testing the insertion into the flat map.", "[flat map]")
+{
+    SECTION("Testing the operator `[]`.")
+    {
+        FlatMap<int, unsigned int> map;
+        REQUIRE(map.empty());
+        REQUIRE(map.capacity() == 0);
+
+        for(int i = 0; i < 1000; i++) {
+            map[i % 100]++;
+        }
+        REQUIRE(map.size() == 100);
+        REQUIRE_FALSE(map.empty());
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(map[i] == 10);
+        }
+        REQUIRE(map.size() == 100);
+        REQUIRE(map.count(5) == 1);
+        REQUIRE(map.count(500) == 0);
+        REQUIRE(map.find(500) == map.end());
+        REQUIRE(map.find(7)->second == 10);
+    }
+    SECTION("Testing the string keys.")
+    {
+        FlatMap<std::string, unsigned int> map(10);
+        REQUIRE(map.capacity() >= 10);
+        map["v1"]++;
+        map[std::string("v2")] += 2;
+        std::string key = "v1";
+        map[key]++;
+
+        REQUIRE(map.size() == 2);
+        REQUIRE(map["v1"] == 2);
+        REQUIRE(map["v2"] == 2);
+        REQUIRE(key == "v1");
+    }
+    SECTION("Testing the existing keys in the full table.")
+    {
+        // 14 keys fill 16 slots: the existing key does not rehash the table.
+        FlatMap<int, unsigned int> map;
+        for(int i = 0; i < 14; i++) {
+            map[i] = 1;
+        }
+        std::size_t capacity = map.capacity();
+        auto first = map.begin();
+        for(int i = 0; i < 14; i++) {
+            map[i]++;
+        }
+        REQUIRE(map.capacity() == capacity);
+        REQUIRE(map.begin() == first);
+        map[14] = 1;
+        REQUIRE(map.capacity() == 2 * capacity);
+        REQUIRE(map[13] == 2);
+    }
+    SECTION("Testing the moved map.")
+    {
+        FlatMap<int, unsigned int> map;
+        for(int i = 0; i < 100; i++) {
+            map[i] = 1;
+        }
+        FlatMap<int, unsigned int> moved(std::move(map));
+        REQUIRE(moved.size() == 100);
+        REQUIRE(map.empty());
+        REQUIRE(map.capacity() == 0);
+        REQUIRE(map.find(5) == map.end());
+        REQUIRE(map.erase(5) == 0);
+        map.clear();
+        map[5]++;
+        REQUIRE(map[5] == 1);
+
+        map = std::move(moved);
+        REQUIRE(map.size() == 100);
+        REQUIRE(moved.empty());
+        moved.clear();
+        moved[7] = 7;
+        REQUIRE(moved.size() == 1);
+        REQUIRE(moved.find(7)->second == 7);
+    }
+}
+
+TEST_CASE("[FlatMap] Testing the removing from the flat map.", "[flat map]")
+{
+    SECTION("Testing the function `erase`.")
+    {
+        FlatMap<int, int> map;
+        for(int i = 0; i < 200; i++) {
+            map[i] = i;
+        }
+        for(int i = 0; i < 200; i += 2) {
+            REQUIRE(map.erase(i) == 1);
+        }
+        REQUIRE(map.erase(0) == 0);
+        REQUIRE(map.size() == 100);
+        for(int i = 0; i < 200; i++) {
+            REQUIRE(map.count(i) == static_cast<std::size_t>(i % 2));
+        }
+
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.begin() == map.end());
+    }
+    SECTION("Testing with random keys.")
+    {
+        FlatMap<unsigned int, unsigned int> map;
+        std::unordered_map<unsigned int, unsigned int> checker;
+        std::mt19937 gen(42);
+        for(int i = 0; i < 50000; i++) {
+            auto key = static_cast<unsigned int>(gen() % 5000);
+            if(gen() % 4 == 0) {
+                REQUIRE(map.erase(key) == checker.erase(key));
+            } else {
+                map[key]++;
+                checker[key]++;
+            }
+        }
+        REQUIRE(map.size() == checker.size());
+        for(const auto& p : checker) {
+            REQUIRE(map.find(p.first) != map.end());
+            REQUIRE(map.find(p.first)->second == p.second);
+        }
+    }
+}
+
+TEST_CASE("[FlatMap] Testing the iterators of the flat map.", "[flat map]")
+{
+    SECTION("Testing the iterators.")
+    {
+        FlatMap<int, unsigned int> map;
+        for(int i = 1; i <= 100; i++) {
+            map[i] = static_cast<unsigned int>(i);
+        }
+        int sum = 0;
+        std::size_t n = 0;
+        for(auto it = map.begin(); it != map.end(); ++it) {
+            REQUIRE(static_cast<unsigned int>(it->first) == it->second);
+            sum += it->first;
+            n++;
+        }
+        REQUIRE(sum == 5050);
+        REQUIRE(n == 100);
+
+        const FlatMap<int, unsigned int>& cmap = map;
+        FlatMap<int, unsigned int>::const_iterator it = map.begin();
+        REQUIRE(it == cmap.begin());
+        REQUIRE(cmap.find(50)->second == 50);
+    }
+}
@@ -0,0 +1,77 @@
+#include <catch.hpp>
+#include "pool.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace pure_c;
+
+TEST_CASE("[pool] Testing the allocation from the pool in C code.", "[pool_c]")
+{
+    SECTION("Testing the reuse of the blocks.")
+    {
+        pool *p = pool_create();
+
+	void *a = pool_alloc(p, 40);
+	void *b = pool_alloc(p, 40);
+	REQUIRE(a != b);
+	REQUIRE((std::uintptr_t)a % alignof(std::max_align_t) == 0);
+	REQUIRE((std::uintptr_t)b % alignof(std::max_align_t) == 0);
+	REQUIRE(p->_allocated == 1);
+	pool_free(p, a, 40);
+	// the block of the same size class is reused.
+	void *c = pool_alloc(p, 64);
+	REQUIRE(c == a);
+	pool_free(p, b, 40);
+	pool_free(p, c, 64);
+
+	// the large blocks are allocated by malloc.
+	void *large = pool_alloc(p, 5000);
+	memset(large, 1, 5000);
+	pool_free(p, large, 5000);
+	REQUIRE(p->_allocated == 1);
+
+        pool_delete(p);
+    }
+    SECTION("Testing the release of the idle slabs.")
+    {
+        pool *p = pool_create();
+
+	std::vector<char *> blocks;
+	for(int i = 0; i < 10000; i++) {
+	    char *block = (char *)pool_alloc(p, 48);
+	    memset(block, i % 128, 48);
+	    blocks.push_back(block);
+	}
+	size_t slabs = p->_allocated;
+	REQUIRE(slabs > 1);
+	REQUIRE(pool_shrink(p) == 0);
+	for(int i = 0; i < 10000; i++) {
+	    REQUIRE(blocks[(size_t)i][47] == (char)(i % 128));
+	}
+
+	// the first half of blocks is released, the slabs of the second half are used.
+	for(size_t i = 0; i < 5000; i++) {
+	    pool_free(p, blocks[i], 48);
+	}
+	size_t released = pool_shrink(p);
+	REQUIRE(released > 0);
+	REQUIRE(p->_allocated == slabs - released);
+	for(size_t i = 5000; i < 10000; i++) {
+	    REQUIRE(blocks[i][0] == (char)(i % 128));
+	}
+
+	// the free blocks of the remaining slabs are still reused.
+	for(size_t i = 0; i < 5000; i++) {
+	    blocks[i] = (char *)pool_alloc(p, 48);
+	    memset(blocks[i], 7, 48);
+	}
+	for(size_t i = 0; i < 10000; i++) {
+	    pool_free(p, blocks[i], 48);
+	}
+	REQUIRE(pool_shrink(p) > 0);
+	REQUIRE(p->_allocated == 0);
+
+        pool_delete(p);
+    }
+}
@@ -1,6 +1,7 @@
 #include <catch.hpp>
 #include "queue.h"
 #include <stdexcept>
+#include <string>
 
 using namespace pure_c;
 
@@ -145,3 +146,301 @@ TEST_CASE("[queue] Testing the getting front and back elements from the queue in
         queue_delete(q);
     }
 }
+
+TEST_CASE("[queue] Testing the values stored in the nodes in C.", "[queue_c]")
+{
+    SECTION("Testing the values of different lengths.")
+    {
+        queue *q = queue_create();
+
+	for(size_t length = 1; length <= 64; length++) {
+	    char block[64];
+	    memset(block, (int)length, length);
+	    queue_enqueue(q, block, length);
+	    // the value is in the same memory block after the node.
+	    REQUIRE((char *)q->_back->value == (char *)q->_back + inline_value_offset(sizeof(queue_node)));
+	    REQUIRE((size_t)q->_back->value % alignof(std::max_align_t) == 0);
+	}
+	for(size_t length = 1; length <= 64; length++) {
+	    char *value = (char *)queue_dequeue(q);
+	    for(size_t i = 0; i < length; i++) {
+		REQUIRE(value[i] == (char)length);
+	    }
+	    free(value);
+	}
+	REQUIRE(q->empty == 1);
+
+        queue_delete(q);
+    }
+}
+
+TEST_CASE("[queue] Testing the getting elements without copying in C.", "[queue_c]")
+{
+    SECTION("Testing the peek functions.")
+    {
+        queue *q = queue_create();
+
+	REQUIRE(queue_peek_front(q) == NULL);
+	REQUIRE(queue_peek_back(q) == NULL);
+	for(int i = 2; i < 520; i = i * 2) {
+	    queue_enqueue(q, &i, sizeof(i));
+	    REQUIRE(*(const int *)queue_peek_back(q) == i);
+	    REQUIRE(*(const int *)queue_peek_front(q) == 2);
+	}
+	REQUIRE(queue_peek_front(q) == q->_front->value);
+	REQUIRE(q->count == 9);
+
+        queue_delete(q);
+    }
+    SECTION("Testing the dequeue into the buffer.")
+    {
+        queue *q = queue_create();
+
+	double buffer[2] = {0, 0};
+	REQUIRE(queue_dequeue_into(q, buffer, sizeof(buffer)) == 0);
+	for(int i = 2; i < 520; i = i * 2) {
+	    queue_enqueue(q, &i, sizeof(i));
+	}
+	double pair[2] = {1.5, 2.5};
+	queue_enqueue(q, pair, sizeof(pair));
+
+	int value = 0;
+	for(int i = 2; i < 520; i = i * 2) {
+	    REQUIRE(queue_dequeue_into(q, &value, sizeof(value)) == sizeof(int));
+	    REQUIRE(value == i);
+	}
+	// the buffer is less than the element: the element stays in the queue.
+	REQUIRE(queue_dequeue_into(q, &value, sizeof(value)) == sizeof(pair));
+	REQUIRE(q->count == 1);
+	REQUIRE(queue_dequeue_into(q, buffer, sizeof(buffer)) == sizeof(pair));
+	REQUIRE(buffer[1] > 2.4);
+	REQUIRE(q->empty == 1);
+	REQUIRE(q->_back == NULL);
+
+        queue_delete(q);
+    }
+    SECTION("Testing the dequeue of the node memory.")
+    {
+        queue *q = queue_create();
+
+	char text[100];
+	for(int i = 0; i < 100; i++) {
+	    text[i] = (char)('a' + i % 26);
+	}
+	queue_enqueue(q, text, sizeof(text));
+	queue_node *node = q->_front;
+	char *result = (char *)queue_dequeue(q);
+	// the value is moved to the beginning of its node.
+	REQUIRE((void *)result == (void *)node);
+	REQUIRE(memcmp(result, text, sizeof(text)) == 0);
+	free(result);
+
+        queue_delete(q);
+    }
+}
+
+TEST_CASE("[queue] Testing the queue of the elements of the same size in C.", "[queue_c]")
+{
+    SECTION("Testing the single elements.")
+    {
+        queue *q = queue_create_fixed(sizeof(int), 3);
+
+	REQUIRE(q != NULL);
+	REQUIRE(q->_capacity == 4);
+	REQUIRE(queue_peek_front(q) == NULL);
+	REQUIRE(queue_dequeue(q) == NULL);
+	for(int i = 0; i < 100; i++) {
+	    queue_enqueue(q, &i, sizeof(i));
+	    REQUIRE(*(const int *)queue_peek_back(q) == i);
+	    if(i % 3 == 2) {
+		int *value = (int *)queue_dequeue(q);
+		REQUIRE(*value == i / 3);
+		free(value);
+	    }
+	}
+	REQUIRE(q->count == 67);
+	int *front = (int *)queue_front(q);
+	int *back = (int *)queue_back(q);
+	REQUIRE(*front == 33);
+	REQUIRE(*back == 99);
+	free(front);
+	free(back);
+
+	int value = 0;
+	for(int i = 33; i < 100; i++) {
+	    REQUIRE(queue_dequeue_into(q, &value, sizeof(value)) == sizeof(int));
+	    REQUIRE(value == i);
+	}
+	REQUIRE(q->empty == 1);
+	REQUIRE(queue_dequeue_into(q, &value, sizeof(value)) == 0);
+	REQUIRE(queue_create_fixed(0, 10) == NULL);
+
+	queue_delete(q);
+    }
+    SECTION("Testing the batches of elements.")
+    {
+        typedef struct
+        {
+            int id;
+            double weight;
+        } record;
+        queue *q = queue_create_fixed(sizeof(record), 8);
+
+	record in[50];
+	record out[50];
+	int next_in = 0;
+	int next_out = 0;
+	// the batches wrap around the end of the ring buffer and grow it.
+	for(int round = 1; round <= 20; round++) {
+	    size_t n = (size_t)(round % 7 + 1) * 3;
+	    for(size_t i = 0; i < n; i++) {
+		in[i].id = next_in++;
+		in[i].weight = in[i].id * 0.5;
+	    }
+	    REQUIRE(queue_enqueue_n(q, in, n) == n);
+	    size_t m = queue_dequeue_n(q, out, (size_t)(round % 5 + 1) * 3);
+	    for(size_t i = 0; i < m; i++) {
+		REQUIRE(out[i].id == next_out);
+		REQUIRE(out[i].weight > next_out * 0.5 - 0.1);
+		next_out++;
+	    }
+	    REQUIRE(q->count == (unsigned int)(next_in - next_out));
+	}
+	while(!q->empty) {
+	    size_t m = queue_dequeue_n(q, out, 50);
+	    for(size_t i = 0; i < m; i++) {
+		REQUIRE(out[i].id == next_out++);
+	    }
+	}
+	REQUIRE(next_out == next_in);
+	REQUIRE(queue_dequeue_n(q, out, 50) == 0);
+
+	queue *nodes = queue_create();
+	REQUIRE(queue_enqueue_n(nodes, in, 5) == 0);
+	queue_delete(nodes);
+	queue_delete(q);
+    }
+}
+
+TEST_CASE("[queue] Testing the queue with the pool of nodes in C.", "[queue_c]")
+{
+    SECTION("Testing the steady state.")
+    {
+        queue *q = queue_create_with_pool();
+
+	REQUIRE(q->_pool != NULL);
+	for(int i = 0; i < 1000; i++) {
+	    queue_enqueue(q, &i, sizeof(i));
+	}
+	size_t slabs = q->_pool->_allocated;
+	int value = 0;
+	for(int i = 0; i < 100000; i++) {
+	    REQUIRE(queue_dequeue_into(q, &value, sizeof(value)) == sizeof(int));
+	    REQUIRE(value == i);
+	    int next = i + 1000;
+	    queue_enqueue(q, &next, sizeof(next));
+	}
+	// the released nodes are reused.
+	REQUIRE(q->_pool->_allocated == slabs);
+	int *front = (int *)queue_dequeue(q);
+	REQUIRE(*front == 100000);
+	free(front);
+	REQUIRE(*(const int *)queue_peek_back(q) == 100999);
+
+	queue_shrink_to_fit(q);
+	REQUIRE(q->_pool->_allocated == 1);
+	while(queue_dequeue_into(q, &value, sizeof(value))) {
+	}
+	queue_shrink_to_fit(q);
+	REQUIRE(q->_pool->_allocated == 0);
+	queue_enqueue(q, &value, sizeof(value));
+	REQUIRE(*(const int *)queue_peek_front(q) == 100999);
+
+        queue_delete(q);
+    }
+}
+
+TEST_CASE("[queue] Testing the batches of elements of different lengths in C.", "[queue_c]")
+{
+    SECTION("Testing the batches of nodes.")
+    {
+        queue *queues[2] = {queue_create(), queue_create_with_pool()};
+
+	const char *words[5] = {"a", "bb", "ccc", "dddd", "eeeee"};
+	size_t lengths[5] = {1, 2, 3, 4, 5};
+	for(queue *q : queues) {
+	    char buffers[5][8];
+	    void *out[5] = {buffers[0], buffers[1], buffers[2], buffers[3], buffers[4]};
+	    size_t capacities[5] = {8, 8, 8, 8, 8};
+	    size_t got[5] = {0, 0, 0, 0, 0};
+	    REQUIRE(queue_dequeue_batch(q, out, capacities, got, 5) == 0);
+	    queue_enqueue(q, "z", 1);
+	    REQUIRE(queue_enqueue_batch(q, (const void *const *)words, lengths, 5) == 5);
+	    REQUIRE(q->count == 6);
+	    REQUIRE(*(const char *)queue_peek_back(q) == 'e');
+
+	    REQUIRE(queue_dequeue_batch(q, out, capacities, got, 3) == 3);
+	    REQUIRE(got[0] == 1);
+	    REQUIRE(buffers[0][0] == 'z');
+	    REQUIRE(got[2] == 2);
+	    REQUIRE(std::string(buffers[2], got[2]) == "bb");
+	    // the buffer is less than the element: the element stays in the queue.
+	    capacities[1] = 3;
+	    REQUIRE(queue_dequeue_batch(q, out, capacities, got, 5) == 1);
+	    REQUIRE(std::string(buffers[0], got[0]) == "ccc");
+	    REQUIRE(q->count == 2);
+	    capacities[1] = 8;
+	    REQUIRE(queue_dequeue_batch(q, out, capacities, NULL, 5) == 2);
+	    REQUIRE(std::string(buffers[1], 5) == "eeeee");
+	    REQUIRE(q->empty == 1);
+	    REQUIRE(queue_peek_back(q) == NULL);
+
+	    // the queue is linked again after it was empty.
+	    REQUIRE(queue_enqueue_batch(q, (const void *const *)words, lengths, 2) == 2);
+	    queue_enqueue(q, "x", 1);
+	    REQUIRE(queue_dequeue_batch(q, out, capacities, got, 5) == 3);
+	    REQUIRE(buffers[2][0] == 'x');
+	    queue_delete(q);
+	}
+    }
+
+    SECTION("Testing the batches of the queue of the elements of the same size.")
+    {
+        queue *q = queue_create_fixed(sizeof(int), 4);
+
+	int values[10];
+	const void *in[10];
+	size_t lengths[10];
+	for(int i = 0; i < 10; i++) {
+	    values[i] = i;
+	    in[i] = &values[i];
+	    lengths[i] = sizeof(int);
+	}
+	int results[10];
+	void *out[10];
+	size_t capacities[10];
+	for(int i = 0; i < 10; i++) {
+	    out[i] = &results[i];
+	    capacities[i] = sizeof(int);
+	}
+	// the batch wraps around the end of the ring buffer and grows it.
+	REQUIRE(queue_enqueue_batch(q, in, lengths, 3) == 3);
+	REQUIRE(queue_dequeue_batch(q, out, capacities, NULL, 2) == 2);
+	REQUIRE(queue_enqueue_batch(q, in + 3, lengths, 7) == 7);
+	REQUIRE(q->count == 8);
+	REQUIRE(*(const int *)queue_peek_back(q) == 9);
+	capacities[5] = 1;
+	REQUIRE(queue_dequeue_batch(q, out, capacities, NULL, 10) == 5);
+	for(int i = 0; i < 5; i++) {
+	    REQUIRE(results[i] == i + 2);
+	}
+	capacities[5] = sizeof(int);
+	size_t got[10];
+	REQUIRE(queue_dequeue_batch(q, out, capacities, got, 10) == 3);
+	REQUIRE(got[2] == sizeof(int));
+	REQUIRE(results[2] == 9);
+	REQUIRE(q->empty == 1);
+
+        queue_delete(q);
+    }
+}
@@ -0,0 +1,163 @@
+#include <catch.hpp>
+#include "shm_queue.h"
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace pure_c;
+
+namespace
+{
+/**
+ * The record, which is passed between the processes.
+ */
+struct record
+{
+    int producer;
+    int number;
+    char text[24];
+};
+
+/**
+ * Returns the name of the segment, which is unique for the test process.
+ */
+std::string segment_name(const char* suffix)
+{
+    return "/containers_test_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+/**
+ * Attaches the queue by the name and inserts the records, waits for the free slots.
+ * Runs in the child process, returns the exit code.
+ */
+int produce(const std::string& name, int producer, int number)
+{
+    shm_queue* q = shm_queue_open(name.c_str());
+    if(q == NULL) {
+        return 1;
+    }
+    for(int i = 0; i < number; i++) {
+        record r{producer, i, "text"};
+        if(shm_queue_push_wait(q, &r, sizeof(r), 10000) != 1) {
+            shm_queue_close(q);
+            return 2;
+        }
+    }
+    shm_queue_close(q);
+    return 0;
+}
+
+/**
+ * Waits for the child process and returns its exit code.
+ */
+int wait_child(pid_t pid)
+{
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+} // namespace
+
+TEST_CASE("[shm queue] Testing the queue in the shared memory in C code.", "[shm_queue_c]")
+{
+    SECTION("Testing the queue in one process.")
+    {
+        std::string name = segment_name("single");
+        shm_queue* q = shm_queue_create(name.c_str(), sizeof(int), 3, SHM_QUEUE_SPSC);
+        REQUIRE(q != NULL);
+        REQUIRE(shm_queue_create(name.c_str(), sizeof(int), 3, SHM_QUEUE_SPSC) == NULL);
+        REQUIRE(shm_queue_slot_size(q) == sizeof(int));
+
+        int value = 0;
+        REQUIRE(shm_queue_pop(q, &value, sizeof(value)) == 0);
+        REQUIRE(shm_queue_pop_wait(q, &value, sizeof(value), 10) == 0);
+        for(int i = 0; i < 4; i++) {
+            REQUIRE(shm_queue_push(q, &i, sizeof(i)) == 1);
+        }
+        // the number of slots is rounded up to 4.
+        REQUIRE(shm_queue_push(q, &value, sizeof(value)) == 0);
+        REQUIRE(shm_queue_push_wait(q, &value, sizeof(value), 10) == 0);
+        REQUIRE(shm_queue_push(q, &value, sizeof(value) + 1) == -1);
+        REQUIRE(shm_queue_count(q) == 4);
+
+        shm_queue* other = shm_queue_open(name.c_str());
+        REQUIRE(other != NULL);
+        short small = 0;
+        REQUIRE(shm_queue_pop(other, &small, sizeof(small)) == sizeof(int));
+        for(int i = 0; i < 4; i++) {
+            REQUIRE(shm_queue_pop(other, &value, sizeof(value)) == sizeof(int));
+            REQUIRE(value == i);
+        }
+        // the slots are reused in the next round.
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(shm_queue_push(q, &i, sizeof(i)) == 1);
+            REQUIRE(shm_queue_pop(other, &value, sizeof(value)) == sizeof(int));
+            REQUIRE(value == i);
+        }
+        shm_queue_close(other);
+        shm_queue_close(q);
+        REQUIRE(shm_queue_unlink(name.c_str()) == 0);
+        REQUIRE(shm_queue_open(name.c_str()) == NULL);
+    }
+    SECTION("Testing one producer process.")
+    {
+        std::string name = segment_name("spsc");
+        shm_queue* q = shm_queue_create(name.c_str(), sizeof(record), 16, SHM_QUEUE_SPSC);
+        REQUIRE(q != NULL);
+
+        const int number = 100000;
+        pid_t pid = fork();
+        if(pid == 0) {
+            _exit(produce(name, 0, number));
+        }
+        record r{};
+        bool ordered = true;
+        for(int i = 0; i < number; i++) {
+            if(shm_queue_pop_wait(q, &r, sizeof(r), 10000) != sizeof(r)) {
+                break;
+            }
+            ordered = ordered && r.number == i && std::string(r.text) == "text";
+        }
+        REQUIRE(ordered);
+        REQUIRE(r.number == number - 1);
+        REQUIRE(wait_child(pid) == 0);
+        REQUIRE(shm_queue_count(q) == 0);
+
+        shm_queue_close(q);
+        shm_queue_unlink(name.c_str());
+    }
+    SECTION("Testing several producer processes.")
+    {
+        std::string name = segment_name("mpsc");
+        shm_queue* q = shm_queue_create(name.c_str(), sizeof(record), 64, SHM_QUEUE_MPSC);
+        REQUIRE(q != NULL);
+
+        const int producers = 4;
+        const int number = 20000;
+        pid_t pids[producers];
+        for(int p = 0; p < producers; p++) {
+            pids[p] = fork();
+            if(pids[p] == 0) {
+                _exit(produce(name, p, number));
+            }
+        }
+        int next[producers] = {0, 0, 0, 0};
+        bool ordered = true;
+        record r{};
+        for(int i = 0; i < producers * number; i++) {
+            if(shm_queue_pop_wait(q, &r, sizeof(r), 10000) != sizeof(r)) {
+                break;
+            }
+            // the records of each producer are in its order.
+            ordered = ordered && r.producer >= 0 && r.producer < producers && r.number == next[r.producer]++;
+        }
+        REQUIRE(ordered);
+        for(int p = 0; p < producers; p++) {
+            REQUIRE(next[p] == number);
+            REQUIRE(wait_child(pids[p]) == 0);
+        }
+
+        shm_queue_close(q);
+        shm_queue_unlink(name.c_str());
+    }
+}
@@ -474,3 +474,177 @@ TEST_CASE("[sorted_list] Testing the custom function to compare elements in the
 	REQUIRE(-12 == list2.pop_front());
     }
 }
+
+TEST_CASE("[sorted_list] Testing the handles of the sorted list.", "[sorted list]")
+{
+    SECTION("Testing the function `erase`.")
+    {
+        sorted_list<int> list = {10, -5, 0};
+
+        auto h1 = list.push_handle(5);
+        auto h2 = list.push_handle(-10);
+        auto h3 = list.push_handle(20);
+        REQUIRE(*h1 == 5);
+        REQUIRE(*h2 == -10);
+        REQUIRE(*h3 == 20);
+        REQUIRE(list.count() == 6);
+
+        REQUIRE(list.erase(h1) == 5);
+        CHECK_FALSE(h1.is_valid());
+        REQUIRE_THROWS_AS(list.erase(h1), std::invalid_argument);
+        REQUIRE(list.count() == 5);
+        REQUIRE(list.at(3) == 10);
+
+        REQUIRE(list.erase(h2) == -10);
+        REQUIRE(list.front() == -5);
+        REQUIRE(list.erase(h3) == 20);
+        REQUIRE(list.back() == 10);
+        REQUIRE(list.count() == 3);
+
+        list.push(7);
+        REQUIRE(list.at(2) == 7);
+        REQUIRE(list.count() == 4);
+    }
+    SECTION("Testing the function `update`.")
+    {
+        sorted_list<int> list = {1, 3, 5, 7, 9};
+        auto h = list.push_handle(4);
+
+        list.update(h, 8);
+        REQUIRE(*h == 8);
+        REQUIRE(list.at(4) == 8);
+        REQUIRE(list.at(5) == 9);
+
+        list.update(h, -1);
+        REQUIRE(list.front() == -1);
+        REQUIRE(list.at(1) == 1);
+
+        list.update(h, 100);
+        REQUIRE(list.back() == 100);
+        REQUIRE(list.count() == 6);
+
+        int previous = list.front();
+        for(auto it = list.begin(); it != list.end(); ++it) {
+            REQUIRE(previous <= *it);
+            previous = *it;
+        }
+        REQUIRE(list.erase(h) == 100);
+        REQUIRE_THROWS_AS(list.update(h, 0), std::invalid_argument);
+    }
+    SECTION("Testing the handles after `reverse` and `pop_front`.")
+    {
+        sorted_list<int> list;
+        auto h1 = list.push_handle(2);
+        auto h2 = list.push_handle(1);
+        list.push(3);
+
+        list.reverse();
+        REQUIRE(*h1 == 2);
+        list.update(h2, 4);
+        REQUIRE(list.front() == 4);
+        REQUIRE(list.back() == 2);
+
+        REQUIRE(list.pop_front() == 4);
+        REQUIRE_THROWS_AS(list.erase(h2), std::invalid_argument);
+        REQUIRE(list.erase(h1) == 2);
+        REQUIRE(list.count() == 1);
+        REQUIRE(list.front() == 3);
+    }
+    SECTION("Testing the handles of the copied list.")
+    {
+        sorted_list<int> orig = {10, 20, 30, 40, 50};
+        sorted_list<int> list(orig);
+
+        auto h = list.push_handle(35);
+        REQUIRE(*h == 35);
+        REQUIRE(list.count() == 6);
+        REQUIRE(list.at(3) == 35);
+        REQUIRE(list.erase(h) == 35);
+        REQUIRE(list.count() == 5);
+        REQUIRE(orig.count() == 5);
+    }
+    SECTION("Testing the positions after `erase` and `update`.")
+    {
+        sorted_list<int> list = {10, 20, 30, 40, 50};
+        auto h10 = list.push_handle(15);
+        auto h20 = list.push_handle(45);
+        REQUIRE(list.push(42) == 5);
+
+        // the removed and the moved nodes are before the last inserted node.
+        list.erase(h10);
+        REQUIRE(list.push(43) == 5);
+        list.update(h20, 5);
+        REQUIRE(list.push(44) == 7);
+        REQUIRE(list.push(25) == 3);
+        REQUIRE(list.at(8) == 44);
+    }
+}
+
+TEST_CASE("[sorted_list] Testing the quantiles of the sorted list.", "[sorted list]")
+{
+    SECTION("Testing the functions `quantile` and `median`.")
+    {
+        sorted_list<double> list;
+        for(int i = 100; i >= 0; i--) {
+            list.push(static_cast<double>(i));
+        }
+
+        REQUIRE(list.quantile(0.0) == Approx(0.0));
+        REQUIRE(list.quantile(1.0) == Approx(100.0));
+        REQUIRE(list.quantile(0.99) == Approx(99.0));
+        REQUIRE(list.quantile(0.25) == Approx(25.0));
+        REQUIRE(list.median() == Approx(50.0));
+        REQUIRE_THROWS_AS(list.quantile(1.5), std::out_of_range);
+        REQUIRE_THROWS_AS(list.quantile(-0.1), std::out_of_range);
+
+        list.reverse();
+        REQUIRE(list.quantile(0.99) == Approx(99.0));
+        REQUIRE(list.quantile(0.0) == Approx(0.0));
+
+        sorted_list<double> empty;
+        REQUIRE_THROWS_AS(empty.median(), std::out_of_range);
+    }
+    SECTION("Testing the function `quantiles`.")
+    {
+        sorted_list<int> list = {9, 3, 7, 1, 5, 0, 2, 4, 6, 8, 10};
+
+        std::vector<int> q = list.quantiles({0.99, 0.5, 0.0, 0.1});
+        REQUIRE(q.size() == 4);
+        REQUIRE(q[0] == 10);
+        REQUIRE(q[1] == 5);
+        REQUIRE(q[2] == 0);
+        REQUIRE(q[3] == 1);
+        REQUIRE_THROWS_AS(list.quantiles({0.5, 2.0}), std::out_of_range);
+    }
+    SECTION("Testing the sliding window.")
+    {
+        sorted_list<int> list;
+        list.set_window(3);
+        REQUIRE(list.window() == 3);
+
+        list.push(10);
+        list.push(1);
+        list.push(5);
+        REQUIRE(list.count() == 3);
+        list.push(7); // removes 10
+        REQUIRE(list.count() == 3);
+        REQUIRE(list.back() == 7);
+        list.push(3); // removes 1
+        REQUIRE(list.front() == 3);
+        REQUIRE(list.median() == 5);
+
+        REQUIRE(list.pop_front() == 3);
+        list.push(4); // the window is not full
+        REQUIRE(list.count() == 3);
+        list.push(6); // removes 5
+        REQUIRE(list.count() == 3);
+        REQUIRE(list.front() == 4);
+        REQUIRE(list.back() == 7);
+
+        list.set_window(1);
+        REQUIRE(list.count() == 1);
+        list.set_window(0);
+        list.push(0);
+        REQUIRE(list.count() == 2);
+    }
+}
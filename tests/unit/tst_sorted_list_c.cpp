@@ -0,0 +1,94 @@
+#include <catch.hpp>
+#include "sorted_list.h"
+#include <algorithm>
+#include <vector>
+
+using namespace pure_c;
+
+namespace
+{
+int compare_double(const void* a, const void* b)
+{
+    double x = *static_cast<const double*>(a), y = *static_cast<const double*>(b);
+    return (x > y) - (x < y);
+}
+} // namespace
+
+TEST_CASE("[sorted_list] Testing the sorted list in C code.", "[sorted_list_c]")
+{
+    SECTION("Testing the creation.")
+    {
+        REQUIRE(c_sorted_list_create(0, compare_double) == NULL);
+        c_sorted_list* l = c_sorted_list_create(sizeof(double), compare_double);
+        REQUIRE(l != NULL);
+        double value = 0;
+        REQUIRE(c_sorted_list_count(l) == 0);
+        REQUIRE(c_sorted_list_pop_front(l, &value) == 0);
+        REQUIRE(c_sorted_list_pop_back(l, &value) == 0);
+        REQUIRE(c_sorted_list_at(l, 0, &value) == 0);
+        REQUIRE(c_sorted_list_remove(l, 0, &value) == 0);
+        c_sorted_list_delete(l);
+    }
+    SECTION("Testing the insertion and removing.")
+    {
+        c_sorted_list* l = c_sorted_list_create(sizeof(double), compare_double);
+        std::vector<double> expected;
+        for(int i = 0; i < 300; i++) {
+            double value = static_cast<double>((i * 7919) % 211) / 4;
+            c_sorted_list_push(l, &value);
+            expected.push_back(value);
+        }
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(c_sorted_list_count(l) == expected.size());
+        double value = 0;
+        for(std::size_t i = 0; i < expected.size(); i += 17) {
+            REQUIRE(c_sorted_list_at(l, i, &value) == 1);
+            REQUIRE(value == Approx(expected[i]));
+        }
+        // removes the elements and inserts new ones, the order is kept.
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(c_sorted_list_pop_front(l, &value) == 1);
+            REQUIRE(value == Approx(expected.front()));
+            expected.erase(expected.begin());
+            REQUIRE(c_sorted_list_pop_back(l, &value) == 1);
+            REQUIRE(value == Approx(expected.back()));
+            expected.pop_back();
+            REQUIRE(c_sorted_list_remove(l, 3, NULL) == 1);
+            expected.erase(expected.begin() + 3);
+
+            double inserted[2] = {static_cast<double>(i % 13), static_cast<double>(i % 29) + 0.5};
+            c_sorted_list_push(l, &inserted[0]);
+            c_sorted_list_push(l, &inserted[1]);
+            expected.insert(std::upper_bound(expected.begin(), expected.end(), inserted[0]), inserted[0]);
+            expected.insert(std::upper_bound(expected.begin(), expected.end(), inserted[1]), inserted[1]);
+        }
+        REQUIRE(c_sorted_list_count(l) == expected.size());
+        for(double e : expected) {
+            REQUIRE(c_sorted_list_pop_front(l, &value) == 1);
+            REQUIRE(value == Approx(e));
+        }
+        REQUIRE(c_sorted_list_count(l) == 0);
+        c_sorted_list_delete(l);
+    }
+    SECTION("Testing the bulk insertion.")
+    {
+        c_sorted_list* l = c_sorted_list_create(sizeof(double), compare_double);
+        std::vector<double> values;
+        for(int i = 0; i < 5000; i++) {
+            values.push_back(static_cast<double>((i * 104729) % 5003));
+        }
+        c_sorted_list_push_n(l, values.data(), values.size());
+        c_sorted_list_push_n(l, values.data(), 100);
+        values.insert(values.end(), values.begin(), values.begin() + 100);
+        std::sort(values.begin(), values.end());
+        REQUIRE(c_sorted_list_count(l) == values.size());
+        double value = 0;
+        bool ordered = true;
+        for(double e : values) {
+            ordered = ordered && c_sorted_list_pop_front(l, &value) == 1 && value >= e && value <= e;
+        }
+        REQUIRE(ordered);
+        c_sorted_list_clear(l);
+        c_sorted_list_delete(l);
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch.hpp>
+#include "space_saving.h"
+#include "counter.h"
+
+#include <string>
+#include <random>
+
+TEST_CASE("[SpaceSaving] Testing the initialization of the `SpaceSaving` class.", "[space saving]")
+{
+    SECTION("Testing the constructors.")
+    {
+        SpaceSaving<int> s(10);
+        REQUIRE(s.capacity() == 10);
+        REQUIRE(s.size() == 0);
+        REQUIRE(s.total() == 0);
+        REQUIRE(s.most_common().empty());
+        REQUIRE_THROWS_AS(SpaceSaving<int>(0), std::invalid_argument);
+
+        std::vector<std::string> v = {"v1", "v2", "v2", "v3", "v3", "v3"};
+        SpaceSaving<std::string> s2(10, v.begin(), v.end());
+        REQUIRE(s2.size() == 3);
+        REQUIRE(s2.total() == 6);
+    }
+}
+
+TEST_CASE("[SpaceSaving] Testing the exact counting.", "[space saving]")
+{
+    SECTION("Testing when all the elements are monitored.")
+    {
+        std::vector<std::string> v = {
+            "v1", "v2", "v3", "v4", "v5",
+            "v6", "v7", "v7", "v7", "v7",
+            "v7", "v6", "v8", "v6", "v1",
+            "v9", "v9", "v11", "v4", "v2",
+            "v8", "v11", "v2", "v1", "v5",
+            "v3", "v1", "v2", "v1", "v5",
+            "v8", "v1", "v3", "v5", "v1",
+            "v8", "v1", "v1", "v4", "v1",
+            "v1", "v1", "v1", "v2", "v2"
+        };
+        Counter<std::string> expected(v.begin(), v.end());
+        SpaceSaving<std::string> s(10, v.begin(), v.end());
+
+        REQUIRE(s.size() == 10);
+        REQUIRE(s.most_common() == expected.most_common());
+        REQUIRE(s.most_common(4) == expected.most_common(4));
+        REQUIRE(s.count("v1") == 13);
+        REQUIRE(s.error("v1") == 0);
+        REQUIRE(s.count("v100") == 0);
+    }
+}
+
+TEST_CASE("[SpaceSaving] Testing the error bounds.", "[space saving]")
+{
+    SECTION("Testing the heavy hitters.")
+    {
+        std::vector<int> v;
+        std::mt19937 gen(7);
+        for(int i = 0; i < 20000; i++) {
+            // 5 heavy elements and a lot of rare elements.
+            v.push_back(i % 4 == 0 ? static_cast<int>(gen() % 5) : static_cast<int>(gen() % 100000) + 10);
+        }
+        Counter<int> exact(v.begin(), v.end());
+        SpaceSaving<int> s(50, v.begin(), v.end());
+
+        REQUIRE(s.size() == 50);
+        REQUIRE(s.total() == v.size());
+
+        auto top = s.most_common(5);
+        REQUIRE(top.size() == 5);
+        for(const auto& p : top) {
+            REQUIRE(p.first < 5);
+        }
+        for(const auto& p : exact.most_common()) {
+            unsigned int estimated = s.count(p.first);
+            if(estimated) {
+                REQUIRE(estimated >= p.second);
+                REQUIRE(estimated - s.error(p.first) <= p.second);
+            } else {
+                REQUIRE(p.second <= s.total() / s.capacity());
+            }
+        }
+        unsigned long sum = 0;
+        for(const auto& p : s.most_common()) {
+            sum += p.second;
+        }
+        REQUIRE(sum == s.total());
+    }
+}
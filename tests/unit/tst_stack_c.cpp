@@ -1,6 +1,7 @@
 #include <catch.hpp>
 #include <stack.h>
 #include <stdexcept>
+#include <string>
 
 using namespace pure_c;
 
@@ -110,3 +111,172 @@ TEST_CASE("[Stack] Testing the getting front element from the stack in C.", "[st
         stack_delete(s);
     }
 }
+
+TEST_CASE("[stack] Testing the values stored in the nodes in C.", "[stack_c]")
+{
+    SECTION("Testing the values of different lengths.")
+    {
+        stack *s = stack_create();
+
+	for(size_t length = 1; length <= 64; length++) {
+	    char block[64];
+	    memset(block, (int)length, length);
+	    stack_push(s, block, length);
+	    // the value is in the same memory block after the node.
+	    REQUIRE((char *)s->front->value == (char *)s->front + inline_value_offset(sizeof(stack_node)));
+	    REQUIRE((size_t)s->front->value % alignof(std::max_align_t) == 0);
+	}
+	for(size_t length = 64; length >= 1; length--) {
+	    char *value = (char *)stack_pop(s);
+	    for(size_t i = 0; i < length; i++) {
+		REQUIRE(value[i] == (char)length);
+	    }
+	    free(value);
+	}
+	REQUIRE(s->empty == 1);
+
+        stack_delete(s);
+    }
+}
+
+TEST_CASE("[stack] Testing the getting elements without copying in C.", "[stack_c]")
+{
+    SECTION("Testing the peek function.")
+    {
+        stack *s = stack_create();
+
+	REQUIRE(stack_peek_front(s) == NULL);
+	for(int i = 2; i < 520; i = i * 2) {
+	    stack_push(s, &i, sizeof(i));
+	    REQUIRE(*(const int *)stack_peek_front(s) == i);
+	}
+	REQUIRE(stack_peek_front(s) == s->front->value);
+	REQUIRE(s->count == 9);
+
+        stack_delete(s);
+    }
+    SECTION("Testing the pop into the buffer.")
+    {
+        stack *s = stack_create();
+
+	double buffer[2] = {0, 0};
+	REQUIRE(stack_pop_into(s, buffer, sizeof(buffer)) == 0);
+	double pair[2] = {1.5, 2.5};
+	stack_push(s, pair, sizeof(pair));
+	for(int i = 2; i < 520; i = i * 2) {
+	    stack_push(s, &i, sizeof(i));
+	}
+
+	int value = 0;
+	for(int i = 512; i >= 2; i = i / 2) {
+	    REQUIRE(stack_pop_into(s, &value, sizeof(value)) == sizeof(int));
+	    REQUIRE(value == i);
+	}
+	// the buffer is less than the element: the element stays in the stack.
+	REQUIRE(stack_pop_into(s, &value, sizeof(value)) == sizeof(pair));
+	REQUIRE(s->count == 1);
+	REQUIRE(stack_pop_into(s, buffer, sizeof(buffer)) == sizeof(pair));
+	REQUIRE(buffer[0] < 1.6);
+	REQUIRE(s->empty == 1);
+
+        stack_delete(s);
+    }
+    SECTION("Testing the pop of the node memory.")
+    {
+        stack *s = stack_create();
+
+	char text[100];
+	for(int i = 0; i < 100; i++) {
+	    text[i] = (char)('a' + i % 26);
+	}
+	stack_push(s, text, sizeof(text));
+	stack_node *node = s->front;
+	char *result = (char *)stack_pop(s);
+	// the value is moved to the beginning of its node.
+	REQUIRE((void *)result == (void *)node);
+	REQUIRE(memcmp(result, text, sizeof(text)) == 0);
+	free(result);
+
+        stack_delete(s);
+    }
+}
+
+TEST_CASE("[stack] Testing the stack with the pool of nodes in C.", "[stack_c]")
+{
+    SECTION("Testing the steady state.")
+    {
+        stack *s = stack_create_with_pool();
+
+	REQUIRE(s->_pool != NULL);
+	for(int i = 0; i < 1000; i++) {
+	    stack_push(s, &i, sizeof(i));
+	}
+	size_t slabs = s->_pool->_allocated;
+	int value = 0;
+	for(int i = 0; i < 100000; i++) {
+	    stack_push(s, &i, sizeof(i));
+	    REQUIRE(stack_pop_into(s, &value, sizeof(value)) == sizeof(int));
+	    REQUIRE(value == i);
+	}
+	// the released nodes are reused.
+	REQUIRE(s->_pool->_allocated == slabs);
+	int *front = (int *)stack_pop(s);
+	REQUIRE(*front == 999);
+	free(front);
+
+	while(stack_pop_into(s, &value, sizeof(value))) {
+	}
+	REQUIRE(value == 0);
+	stack_shrink_to_fit(s);
+	REQUIRE(s->_pool->_allocated == 0);
+	stack_push(s, &value, sizeof(value));
+	REQUIRE(*(const int *)stack_peek_front(s) == 0);
+
+        stack_delete(s);
+    }
+}
+
+TEST_CASE("[stack] Testing the batches of elements of different lengths in C.", "[stack_c]")
+{
+    SECTION("Testing the batches of nodes.")
+    {
+        stack *stacks[2] = {stack_create(), stack_create_with_pool()};
+
+	const char *words[5] = {"a", "bb", "ccc", "dddd", "eeeee"};
+	size_t lengths[5] = {1, 2, 3, 4, 5};
+	for(stack *s : stacks) {
+	    char buffers[5][8];
+	    void *out[5] = {buffers[0], buffers[1], buffers[2], buffers[3], buffers[4]};
+	    size_t capacities[5] = {8, 8, 8, 8, 8};
+	    size_t got[5] = {0, 0, 0, 0, 0};
+	    REQUIRE(stack_pop_batch(s, out, capacities, got, 5) == 0);
+	    stack_push(s, "z", 1);
+	    REQUIRE(stack_push_batch(s, (const void *const *)words, lengths, 5) == 5);
+	    REQUIRE(s->count == 6);
+	    // the last element of the batch is the first.
+	    REQUIRE(*(const char *)stack_peek_front(s) == 'e');
+
+	    REQUIRE(stack_pop_batch(s, out, capacities, got, 2) == 2);
+	    REQUIRE(std::string(buffers[0], got[0]) == "eeeee");
+	    REQUIRE(std::string(buffers[1], got[1]) == "dddd");
+	    // the buffer is less than the element: the element stays in the stack.
+	    capacities[1] = 1;
+	    REQUIRE(stack_pop_batch(s, out, capacities, got, 5) == 1);
+	    REQUIRE(std::string(buffers[0], got[0]) == "ccc");
+	    REQUIRE(s->count == 3);
+	    capacities[1] = 8;
+	    REQUIRE(stack_pop_batch(s, out, capacities, NULL, 5) == 3);
+	    REQUIRE(buffers[2][0] == 'z');
+	    REQUIRE(s->empty == 1);
+	    REQUIRE(stack_peek_front(s) == NULL);
+
+	    // the stack is linked again after it was empty.
+	    REQUIRE(stack_push_batch(s, (const void *const *)words, lengths, 2) == 2);
+	    stack_push(s, "x", 1);
+	    REQUIRE(stack_pop_batch(s, out, capacities, got, 5) == 3);
+	    REQUIRE(buffers[0][0] == 'x');
+	    REQUIRE(buffers[2][0] == 'a');
+	    stack_delete(s);
+	}
+    }
+}
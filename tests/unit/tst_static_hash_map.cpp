@@ -0,0 +1,55 @@
+#include <catch.hpp>
+#include <static_hash_map.h>
+
+#include <string_view>
+#include <stdexcept>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+constexpr StaticArray<std::string_view, 12> keywords = {
+    "if"sv, "else"sv, "for"sv, "while"sv, "do"sv, "return"sv,
+    "break"sv, "continue"sv, "switch"sv, "case"sv, "default"sv, "goto"sv
+};
+constexpr auto opcodes = StaticArray<int, 12>::make_sequence();
+constexpr StaticHashMap<std::string_view, int, 12> keyword_map(keywords, opcodes);
+} // namespace
+
+TEST_CASE("[static hash map] Testing the lookup at compile time.", "[static hash map]") {
+	SECTION("Testing the string keys.") {
+		static_assert(keyword_map.size() == 12);
+		static_assert(*keyword_map.find("if") == 0);
+		static_assert(*keyword_map.find("goto") == 11);
+		static_assert(keyword_map.at("return") == 5);
+		static_assert(keyword_map.index("while") == 3);
+		static_assert(keyword_map.contains("case"));
+		static_assert(!keyword_map.contains("iff"));
+		static_assert(keyword_map.find("") == nullptr);
+		static_assert(keyword_map.index("void") == 12);
+
+		for (std::size_t i = 0; i < keywords.count(); i++) {
+			REQUIRE(keyword_map.at(keywords[i]) == static_cast<int>(i));
+		}
+		REQUIRE_THROWS_AS(keyword_map.at("void"), std::out_of_range);
+	}
+	SECTION("Testing the integral keys.") {
+		constexpr StaticArray<unsigned, 6> keys = {100u, 7u, 42u, 1000000u, 3u, 0u};
+		constexpr StaticArray<char, 6> values = {'a', 'b', 'c', 'd', 'e', 'f'};
+		constexpr StaticHashMap map(keys, values);
+		static_assert(map.at(42u) == 'c');
+		static_assert(map.at(0u) == 'f');
+		static_assert(!map.contains(1u));
+
+		unsigned found = 0;
+		for (unsigned k = 0; k < 2000; k++) {
+			found += map.contains(k) ? 1 : 0;
+		}
+		REQUIRE(found == 5);
+	}
+	SECTION("Testing the duplicated keys.") {
+		StaticArray<int, 3> keys = {1, 2, 1};
+		StaticArray<int, 3> values = {1, 2, 3};
+		REQUIRE_THROWS_AS((StaticHashMap<int, int, 3>(keys, values)), std::invalid_argument);
+	}
+}
@@ -0,0 +1,120 @@
+#include <catch.hpp>
+#include <static_vector.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+/**
+ * The type without the default constructor, which counts its living objects.
+ */
+struct Item
+{
+    explicit Item(int v) : value(v) { alive++; }
+    Item(const Item& other) : value(other.value) { alive++; }
+    Item(Item&& other) noexcept : value(other.value) { alive++; }
+    Item& operator=(const Item& other) = default;
+    Item& operator=(Item&& other) noexcept = default;
+    ~Item() { alive--; }
+
+    int value;
+    static int alive;
+};
+int Item::alive = 0;
+} // namespace
+
+TEST_CASE("[static vector] Testing the adding and removing.", "[static vector]") {
+	SECTION("Testing push_back, emplace_back and pop_back.") {
+		StaticVector<std::string, 3> v;
+		REQUIRE(v.empty());
+		REQUIRE(v.capacity() == 3);
+		v.push_back("a");
+		std::string b = "b";
+		v.push_back(std::move(b));
+		REQUIRE(v.emplace_back(2, 'c') == "cc");
+		REQUIRE(v.full());
+		REQUIRE(v.size() == 3);
+		REQUIRE(v.front() == "a");
+		REQUIRE(v.back() == "cc");
+		REQUIRE_THROWS_AS(v.push_back("d"), std::length_error);
+		v.pop_back();
+		REQUIRE(v.size() == 2);
+		REQUIRE(v.back() == "b");
+		v.clear();
+		REQUIRE(v.empty());
+		REQUIRE_THROWS_AS(v.pop_back(), std::out_of_range);
+	}
+	SECTION("Testing insert and erase.") {
+		StaticVector<int, 5> v = {1, 2, 3};
+		auto it = v.insert(v.begin(), 0);
+		REQUIRE(*it == 0);
+		it = v.insert(v.end(), 4);
+		REQUIRE(*it == 4);
+		REQUIRE(v.full());
+		REQUIRE_THROWS_AS(v.insert(v.begin() + 2, 9), std::length_error);
+		for(int i = 0; i < 5; i++) {
+			REQUIRE(v[static_cast<std::size_t>(i)] == i);
+		}
+		it = v.erase(v.begin() + 1);
+		REQUIRE(*it == 2);
+		it = v.erase(v.end() - 1);
+		REQUIRE(it == v.end());
+		REQUIRE(v.size() == 3);
+		REQUIRE(v.at(0) == 0);
+		REQUIRE(v.at(1) == 2);
+		REQUIRE(v.at(2) == 3);
+		REQUIRE_THROWS_AS(v.at(3), std::out_of_range);
+		REQUIRE_THROWS_AS((StaticVector<int, 2>{1, 2, 3}), std::length_error);
+	}
+}
+
+TEST_CASE("[static vector] Testing the lifetime of elements.", "[static vector]") {
+	SECTION("Testing the type without the default constructor.") {
+		{
+			StaticVector<Item, 4> v;
+			REQUIRE(Item::alive == 0);
+			v.emplace_back(1);
+			v.push_back(Item(2));
+			v.emplace_back(3);
+			REQUIRE(Item::alive == 3);
+			v.insert(v.begin(), Item(0));
+			REQUIRE(Item::alive == 4);
+			v.erase(v.begin() + 2);
+			REQUIRE(Item::alive == 3);
+			REQUIRE(v[0].value == 0);
+			REQUIRE(v[1].value == 1);
+			REQUIRE(v[2].value == 3);
+
+			StaticVector<Item, 4> copy(v);
+			REQUIRE(Item::alive == 6);
+			StaticVector<Item, 4> moved(std::move(copy));
+			REQUIRE(copy.empty());
+			REQUIRE(Item::alive == 6);
+			copy = moved;
+			REQUIRE(copy.size() == 3);
+			REQUIRE(Item::alive == 9);
+			v = std::move(copy);
+			REQUIRE(Item::alive == 6);
+			REQUIRE(v[2].value == 3);
+		}
+		REQUIRE(Item::alive == 0);
+	}
+	SECTION("Testing the move-only type.") {
+		StaticVector<std::unique_ptr<int>, 2> v;
+		v.push_back(std::make_unique<int>(1));
+		v.emplace_back(new int(2));
+		StaticVector<std::unique_ptr<int>, 2> moved(std::move(v));
+		REQUIRE(*moved[0] == 1);
+		REQUIRE(*moved[1] == 2);
+		REQUIRE(v.empty());
+	}
+	SECTION("Testing the storage.") {
+		static_assert(sizeof(StaticVector<double, 8>) >= 8 * sizeof(double));
+		static_assert(alignof(StaticVector<double, 8>) >= alignof(double));
+		StaticVector<double, 8> v;
+		REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % alignof(double) == 0);
+	}
+}
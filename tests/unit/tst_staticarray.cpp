@@ -1,10 +1,88 @@
 #include <catch.hpp>
 #include <staticarray.h>
 #include <extensions.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <vector>
 
 
 using namespace constexpr_extensions;
 
+// The compared values are integers, so the sums of `float` are exact.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+namespace
+{
+/**
+ * Compares the reductions of the array with the standard algorithms.
+ */
+template<typename T, std::size_t Size>
+void check_reductions(std::mt19937& gen)
+{
+	StaticArray<T, Size> a;
+	StaticArray<T, Size> b;
+	for (std::size_t i = 0; i < Size; i++) {
+		a[i] = static_cast<T>(static_cast<int>(gen() % 41) - 20);
+		b[i] = static_cast<T>(static_cast<int>(gen() % 41) - 20);
+	}
+	REQUIRE(a.sum() == std::accumulate(a.begin(), a.end(), T{}));
+	REQUIRE(a.min() == *std::min_element(a.begin(), a.end()));
+	REQUIRE(a.max() == *std::max_element(a.begin(), a.end()));
+	REQUIRE(a.dot(b) == std::inner_product(a.begin(), a.end(), b.begin(), T{}));
+	for (int v = -21; v <= 21; v++) {
+		auto value = static_cast<T>(v);
+		REQUIRE(a.find(value) == static_cast<std::size_t>(std::find(a.begin(), a.end(), value) - a.begin()));
+		REQUIRE(a.count_if_equal(value) == static_cast<std::size_t>(std::count(a.begin(), a.end(), value)));
+	}
+}
+} // namespace
+#pragma GCC diagnostic pop
+
+namespace
+{
+/**
+ * The table of CRC-32 (the polynomial 0xEDB88320).
+ */
+constexpr auto crc_table = StaticArray<std::uint32_t, 256>::generate([](std::size_t i) {
+	auto c = static_cast<std::uint32_t>(i);
+	for (int k = 0; k < 8; k++) {
+		c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+	}
+	return c;
+});
+/**
+ * Computes CRC-32 with the table.
+ */
+constexpr std::uint32_t crc32(std::string_view data)
+{
+	std::uint32_t c = 0xFFFFFFFFu;
+	for (char ch : data) {
+		c = crc_table[(c ^ static_cast<unsigned char>(ch)) & 0xFF] ^ (c >> 8);
+	}
+	return c ^ 0xFFFFFFFFu;
+}
+/**
+ * The bit-reversal permutation of 16 elements.
+ */
+constexpr auto bit_reversal = StaticArray<std::size_t, 16>::generate([](std::size_t i) {
+	return ((i & 1) << 3) | ((i & 2) << 1) | ((i & 4) >> 1) | ((i & 8) >> 3);
+});
+/**
+ * The table of integer base-2 logarithms.
+ */
+constexpr auto log2_table = StaticArray<int, 65>::generate([](std::size_t i) {
+	int result = -1;
+	for (; i; i >>= 1) {
+		result++;
+	}
+	return result;
+});
+} // namespace
+
 TEST_CASE("[static array] Testing the initialization of the static array.", "[static array]") {
 	SECTION("Testing the initialiation №1.") {
 		constexpr StaticArray<int, 20> array;
@@ -180,3 +258,155 @@ TEST_CASE("[static array] Testing the `make_sequence` method.", "[static array]"
 		REQUIRE(array.count() == 15);
 	}
 }
+
+TEST_CASE("[static array] Testing the mutable StaticArray.", "[static array]") {
+	SECTION("Testing the copying and the mutable operators.") {
+		constexpr auto array = []() constexpr {
+			StaticArray<int, 4> a = {1, 2, 3, 4};
+			StaticArray<int, 4> b = a;
+			b[0] = 10;
+			b[Index<3>()] = 40;
+			a = b;
+			return a;
+		}();
+		static_assert(array[0] == 10);
+		static_assert(array[1] == 2);
+		static_assert(array[3] == 40);
+
+		StaticArray<int, 4> copy = array;
+		StaticArray<int, 4> moved = std::move(copy);
+		int sum = 0;
+		for (int v : moved) {
+			sum += v;
+		}
+		REQUIRE(sum == 55);
+		REQUIRE(moved.count() == 4);
+	}
+	SECTION("Testing the `fill` and `transform` methods.") {
+		constexpr auto array = []() constexpr {
+			StaticArray<unsigned, 8> a;
+			a.fill(3u);
+			a.transform([](unsigned v) { return v * v; });
+			return a;
+		}();
+		static_assert(array[0] == 9);
+		static_assert(array[7] == 9);
+		static_assert(array.count() == 8);
+
+		constexpr auto squares = []() constexpr {
+			auto a = StaticArray<unsigned, 10>::make_sequence();
+			a.transform([](unsigned v) { return v * v; });
+			return a;
+		}();
+		static_assert(squares[9] == 81);
+	}
+	SECTION("Testing the `sort` and `binary_search` methods.") {
+		constexpr auto array = []() constexpr {
+			StaticArray<int, 10> a = {5, 9, 1, 7, 3, 8, 2, 6, 0, 4};
+			a.sort();
+			return a;
+		}();
+		CONSTEXPR_LOOP<10>([&](auto i) constexpr {
+			static_assert(array[i] == static_cast<int>(i.value));
+		});
+		static_assert(array.binary_search(7));
+		static_assert(!array.binary_search(10));
+		static_assert(!array.binary_search(-1));
+
+		constexpr auto reversed = []() constexpr {
+			StaticArray<int, 7> a = {5, 1, 6, 3, 0, 2, 4};
+			a.sort(std::greater<int>());
+			return a;
+		}();
+		static_assert(reversed[0] == 6);
+		static_assert(reversed[6] == 0);
+		static_assert(reversed.binary_search(3, std::greater<int>()));
+
+		std::mt19937 gen(1);
+		for (int n = 0; n < 100; n++) {
+			StaticArray<int, 37> a;
+			for (auto& v : a) {
+				v = static_cast<int>(gen() % 50);
+			}
+			std::vector<int> expected(a.begin(), a.end());
+			std::sort(expected.begin(), expected.end());
+			a.sort();
+			REQUIRE(std::vector<int>(a.begin(), a.end()) == expected);
+			REQUIRE(a.binary_search(expected[5]));
+		}
+	}
+}
+
+TEST_CASE("[static array] Testing the reductions of the static array.", "[static array]") {
+	SECTION("Testing the reductions at compile time.") {
+		constexpr StaticArray<int, 10> a = {3, -1, 4, 1, -5, 9, 2, 6, 5, 3};
+		constexpr StaticArray<int, 10> b = {1, 1, 1, 1, 1, 1, 1, 1, 1, 2};
+		static_assert(a.sum() == 27);
+		static_assert(a.min() == -5);
+		static_assert(a.max() == 9);
+		static_assert(a.find(3) == 0);
+		static_assert(a.find(7) == 10);
+		static_assert(a.count_if_equal(3) == 2);
+		static_assert(a.dot(b) == 30);
+		constexpr auto f = StaticArray<float, 40>::make_sequence();
+		static_assert(f.sum() > 779.5f && f.sum() < 780.5f);
+		static_assert(f.max() > 38.5f && f.max() < 39.5f);
+	}
+	SECTION("Testing the reductions at run time.") {
+		std::mt19937 gen(2);
+		for (int n = 0; n < 10; n++) {
+			check_reductions<int, 1>(gen);
+			check_reductions<int, 7>(gen);
+			check_reductions<int, 8>(gen);
+			check_reductions<int, 37>(gen);
+			check_reductions<int, 1000>(gen);
+			check_reductions<float, 3>(gen);
+			check_reductions<float, 16>(gen);
+			check_reductions<float, 61>(gen);
+			check_reductions<float, 1027>(gen);
+			check_reductions<double, 19>(gen);
+		}
+	}
+	SECTION("Testing the alignment.") {
+		static_assert(alignof(StaticArray<float, 16>) == 64);
+		static_assert(alignof(StaticArray<char, 4>) == alignof(std::size_t));
+		StaticArray<int, 100> a;
+		REQUIRE(reinterpret_cast<std::uintptr_t>(a.begin()) % 64 == 0);
+	}
+}
+
+TEST_CASE("[static array] Testing the generation of the static array.", "[static array]") {
+	SECTION("Testing the tables at compile time.") {
+		static_assert(crc_table[0] == 0);
+		static_assert(crc_table[1] == 0x77073096u);
+		static_assert(crc_table[255] == 0x2D02EF8Du);
+		static_assert(crc32("123456789") == 0xCBF43926u);
+		static_assert(bit_reversal[1] == 8);
+		static_assert(bit_reversal[6] == 6);
+		static_assert(bit_reversal[11] == 13);
+		static_assert(log2_table[1] == 0);
+		static_assert(log2_table[64] == 6);
+		static_assert(log2_table[63] == 5);
+		static_assert(crc_table.count() == 256);
+		static_assert(StaticArray<int, 4>::generate([](std::size_t i) { return static_cast<int>(i) - 1; })[0] == -1);
+	}
+	SECTION("Testing the constant initialization.") {
+		// The values are usable as the template arguments only if the tables are constant-initialized.
+		REQUIRE(std::integral_constant<std::uint32_t, crc_table[128]>::value == 0xEDB88320u);
+		REQUIRE(std::integral_constant<std::size_t, bit_reversal[3]>::value == 12);
+		static_assert(std::is_trivially_destructible_v<decltype(crc_table)>);
+		for (std::size_t i = 0; i < bit_reversal.count(); i++) {
+			REQUIRE(bit_reversal[bit_reversal[i]] == i);
+		}
+	}
+	SECTION("Testing the generation at run time.") {
+		int calls = 0;
+		auto a = StaticArray<int, 5>::generate([&calls](std::size_t i) {
+			calls++;
+			return static_cast<int>(i * i);
+		});
+		REQUIRE(calls == 5);
+		REQUIRE(a[4] == 16);
+		REQUIRE(a.sum() == 30);
+	}
+}
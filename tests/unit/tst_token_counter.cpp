@@ -0,0 +1,100 @@
+#include <catch.hpp>
+#include "token_counter.h"
+#include "counter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("[TokenCounter] Testing the counting of tokens.", "[token counter]")
+{
+    SECTION("Testing the sequence of tokens.")
+    {
+        std::vector<std::string> v = {"v1", "v2", "v2", "v3", "v3", "v3"};
+        TokenCounter c(v.begin(), v.end());
+        REQUIRE(c.size() == 3);
+        REQUIRE(c.count("v3") == 3);
+        REQUIRE(c.count("v4") == 0);
+        REQUIRE(c.most_common() == TokenCounter::vector_t{{"v3", 3}, {"v2", 2}, {"v1", 1}});
+        REQUIRE(c.most_common(1) == TokenCounter::vector_t{{"v3", 3}});
+
+        // The views point to the arena, not to the sequence.
+        v.clear();
+        REQUIRE(c.most_common(1).at(0).first == "v3");
+    }
+    SECTION("Testing the text.")
+    {
+        std::string long_token(100000, 'x');
+        std::string text = "  the quick\tbrown fox\njumps over the lazy dog the end " + long_token + " " + long_token;
+        TokenCounter c;
+        c.count_text(text);
+        REQUIRE(c.count("the") == 3);
+        REQUIRE(c.count(long_token) == 2);
+        REQUIRE(c.size() == 10);
+
+        TokenCounter other;
+        other.count_text("the fox fox new");
+        c.merge(other);
+        REQUIRE(c.count("the") == 4);
+        REQUIRE(c.count("new") == 1);
+
+        c.merge(std::move(other));
+        REQUIRE(other.size() == 0);
+        REQUIRE(c.count("fox") == 5);
+        REQUIRE(c.most_common(2) == TokenCounter::vector_t{{"fox", 5}, {"the", 5}});
+    }
+    SECTION("Testing the empty token and the moved counter.")
+    {
+        TokenCounter c;
+        c.push("");
+        c.push("");
+        REQUIRE(c.count("") == 2);
+        c.push("a");
+        REQUIRE(c.size() == 2);
+
+        TokenCounter moved(std::move(c));
+        REQUIRE(moved.count("a") == 1);
+        REQUIRE(c.size() == 0);
+        // The moved-from counter allocates a new block.
+        c.push("");
+        c.push("b");
+        REQUIRE(c.count("b") == 1);
+        c = std::move(moved);
+        REQUIRE(c.count("") == 2);
+        REQUIRE(moved.size() == 0);
+        moved.push("c");
+        REQUIRE(moved.count("c") == 1);
+    }
+}
+
+TEST_CASE("[TokenCounter] Testing the counting of a file.", "[token counter]")
+{
+    SECTION("Testing the file in several threads.")
+    {
+        std::string path = "tst_token_counter.txt";
+        std::vector<std::string> words;
+        {
+            std::ofstream file(path);
+            for(int i = 0; i < 200000; i++) {
+                std::string word = "w" + std::to_string(i % 1000 * (i % 7));
+                words.push_back(word);
+                file << word << (i % 10 ? " " : "\n");
+            }
+        }
+        Counter<std::string> expected(words.begin(), words.end());
+        TokenCounter c = TokenCounter::count_file(path, 4);
+        REQUIRE(c.size() == expected.size());
+        auto result = c.most_common();
+        auto expected_result = expected.most_common();
+        REQUIRE(result.size() == expected_result.size());
+        for(std::size_t i = 0; i < result.size(); i++) {
+            REQUIRE(result[i].first == expected_result[i].first);
+            REQUIRE(result[i].second == expected_result[i].second);
+        }
+        std::remove(path.c_str());
+
+        REQUIRE_THROWS_AS(TokenCounter::count_file("not_existing_file.txt"), std::runtime_error);
+    }
+}
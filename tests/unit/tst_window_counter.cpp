@@ -0,0 +1,82 @@
+#include <catch.hpp>
+#include "window_counter.h"
+
+#include <chrono>
+#include <string>
+
+/*
+ * The clock, which is moved by the tests.
+ */
+struct TestClock
+{
+    using duration = std::chrono::seconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<TestClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept { return current; }
+    static inline time_point current{};
+};
+
+TEST_CASE("[WindowCounter] Testing the count-based window.", "[window counter]")
+{
+    SECTION("Testing the expiry of the buckets.")
+    {
+        REQUIRE_THROWS_AS(WindowCounter<int>(0, 10), std::invalid_argument);
+        REQUIRE_THROWS_AS(WindowCounter<int>(3, 0), std::invalid_argument);
+
+        std::string s = "aaab";
+        WindowCounter<char> c(3, 4);
+        c.update(s.begin(), s.end());
+        REQUIRE(c.total() == 4);
+        REQUIRE(c.most_common() == WindowCounter<char>::vector_t{{'a', 3}, {'b', 1}});
+
+        std::string s2 = "bbbbcccc";
+        c.update(s2.begin(), s2.end());
+        REQUIRE(c.total() == 12);
+        REQUIRE(c.most_common(1) == WindowCounter<char>::vector_t{{'b', 5}});
+
+        // The first bucket is expired.
+        c.push('d');
+        REQUIRE(c.total() == 9);
+        REQUIRE(c.size() == 3);
+        REQUIRE(c.most_common() == WindowCounter<char>::vector_t{{'b', 4}, {'c', 4}, {'d', 1}});
+
+        c.rotate();
+        c.rotate();
+        REQUIRE(c.most_common() == WindowCounter<char>::vector_t{{'d', 1}});
+        c.rotate();
+        REQUIRE(c.most_common().empty());
+        REQUIRE(c.total() == 0);
+    }
+}
+
+TEST_CASE("[WindowCounter] Testing the time-based window.", "[window counter]")
+{
+    SECTION("Testing the expiry of the periods.")
+    {
+        using counter_t = WindowCounter<std::string, true, std::unordered_map<std::string, unsigned int>, TestClock>;
+        counter_t c(5, std::chrono::minutes(1));
+        REQUIRE(c.buckets() == 5);
+
+        c.push("v1");
+        c.push("v1");
+        TestClock::current += std::chrono::seconds(90);
+        c.push("v2");
+        REQUIRE(c.most_common() == counter_t::vector_t{{"v1", 2}, {"v2", 1}});
+
+        // The first minute is expired.
+        TestClock::current += std::chrono::minutes(4);
+        REQUIRE(c.most_common() == counter_t::vector_t{{"v2", 1}});
+
+        // All the minutes are expired.
+        TestClock::current += std::chrono::hours(1);
+        REQUIRE(c.size() == 0);
+        c.push("v3");
+        TestClock::current += std::chrono::minutes(4);
+        REQUIRE(c.most_common() == counter_t::vector_t{{"v3", 1}});
+        TestClock::current += std::chrono::minutes(1);
+        REQUIRE(c.total() == 0);
+    }
+}